@@ -0,0 +1,217 @@
+// Alphabet.hpp
+//
+// An alphabet is the set of characters that WordChecker::findSuggestions()
+// tries when it inserts or replaces a character.  The project write-up
+// uses 'A' through 'Z', but a dictionary of lowercase words (with
+// apostrophes, such as "don't") needs a different set: trying uppercase
+// letters wastes a lookup on every one, and never trying an apostrophe
+// misses real suggestions.
+//
+// Each alphabet is a type with a static constexpr std::string_view named
+// letters, so the candidate loops that use it are instantiated (and can
+// be unrolled) for exactly its letters at compile time.  The letters are
+// UTF-8, so an alphabet can hold letters like 'ä' that take more than one
+// byte; alphabetCodePoints() splits them apart.  Larger alphabets are
+// built from smaller ones with AlphabetUnion, e.g.,
+//
+//     using MixedCaseAlphabet = AlphabetUnion<UppercaseAlphabet, LowercaseAlphabet>;
+
+#ifndef ALPHABET_HPP
+#define ALPHABET_HPP
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+
+
+struct UppercaseAlphabet
+{
+    static constexpr std::string_view letters{"ABCDEFGHIJKLMNOPQRSTUVWXYZ"};
+};
+
+
+struct LowercaseAlphabet
+{
+    static constexpr std::string_view letters{"abcdefghijklmnopqrstuvwxyz"};
+};
+
+
+struct DigitAlphabet
+{
+    static constexpr std::string_view letters{"0123456789"};
+};
+
+
+struct ApostropheAlphabet
+{
+    static constexpr std::string_view letters{"'"};
+};
+
+
+// The letters German adds to 'a' through 'z': ä ö ü ß.
+struct GermanLetterAlphabet
+{
+    static constexpr std::string_view letters{"\xC3\xA4\xC3\xB6\xC3\xBC\xC3\x9F"};
+};
+
+
+// The letters French adds to 'a' through 'z':
+// à â æ ç é è ê ë î ï ô œ ù û ü ÿ.
+struct FrenchLetterAlphabet
+{
+    static constexpr std::string_view letters{
+        "\xC3\xA0\xC3\xA2\xC3\xA6\xC3\xA7\xC3\xA9\xC3\xA8\xC3\xAA\xC3\xAB"
+        "\xC3\xAE\xC3\xAF\xC3\xB4\xC5\x93\xC3\xB9\xC3\xBB\xC3\xBC\xC3\xBF"};
+};
+
+
+
+// isUtf8ContinuationByte() returns true if the given byte continues a
+// multi-byte UTF-8 sequence, rather than starting a character.
+constexpr bool isUtf8ContinuationByte(char c) noexcept
+{
+    return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+}
+
+
+
+namespace impl_
+{
+    template <std::size_t Size, typename... Alphabets>
+    constexpr std::array<char, Size> AlphabetUnion__concatenate() noexcept
+    {
+        std::array<char, Size> letters{};
+        std::size_t next = 0;
+
+        for(std::string_view part : {Alphabets::letters...}){
+            for(char c : part){
+                letters[next++] = c;
+            }
+        }
+
+        return letters;
+    }
+
+
+    template <typename Alphabet>
+    constexpr std::array<bool, 256> Alphabet__makeTable() noexcept
+    {
+        std::array<bool, 256> table{};
+
+        for(char c : Alphabet::letters){
+            table[static_cast<unsigned char>(c)] = true;
+        }
+
+        return table;
+    }
+
+
+    template <typename Alphabet>
+    struct Alphabet__table
+    {
+        static constexpr std::array<bool, 256> table = Alphabet__makeTable<Alphabet>();
+    };
+
+
+    template <typename Alphabet>
+    constexpr std::size_t Alphabet__countCodePoints() noexcept
+    {
+        std::size_t count = 0;
+
+        for(char c : Alphabet::letters){
+            if(!isUtf8ContinuationByte(c)){
+                count++;
+            }
+        }
+
+        return count;
+    }
+
+
+    template <typename Alphabet, std::size_t Count>
+    constexpr std::array<std::string_view, Count> Alphabet__splitCodePoints() noexcept
+    {
+        std::array<std::string_view, Count> codePoints{};
+        std::string_view letters = Alphabet::letters;
+        std::size_t start = 0;
+
+        for(std::size_t i = 0; i < Count; i++){
+            std::size_t end = start + 1;
+            while(end < letters.size() && isUtf8ContinuationByte(letters[end])){
+                end++;
+            }
+            codePoints[i] = letters.substr(start, end - start);
+            start = end;
+        }
+
+        return codePoints;
+    }
+
+
+    template <typename Alphabet>
+    struct Alphabet__codePoints
+    {
+        static constexpr std::size_t COUNT = Alphabet__countCodePoints<Alphabet>();
+        static constexpr std::array<std::string_view, COUNT> codePoints =
+            Alphabet__splitCodePoints<Alphabet, COUNT>();
+    };
+}
+
+
+
+// AlphabetUnion is an alphabet with the letters of each of the given
+// alphabets, in the order given.  The alphabets shouldn't overlap, or the
+// overlapping letters will be tried twice.
+template <typename... Alphabets>
+struct AlphabetUnion
+{
+private:
+    static constexpr std::size_t SIZE = (Alphabets::letters.size() + ...);
+    static constexpr std::array<char, SIZE> storage =
+        impl_::AlphabetUnion__concatenate<SIZE, Alphabets...>();
+
+public:
+    static constexpr std::string_view letters{storage.data(), SIZE};
+};
+
+
+using MixedCaseAlphabet = AlphabetUnion<UppercaseAlphabet, LowercaseAlphabet>;
+using LowercaseApostropheAlphabet = AlphabetUnion<LowercaseAlphabet, ApostropheAlphabet>;
+using MixedCaseApostropheAlphabet = AlphabetUnion<UppercaseAlphabet, LowercaseAlphabet, ApostropheAlphabet>;
+using AlphanumericAlphabet = AlphabetUnion<UppercaseAlphabet, LowercaseAlphabet, DigitAlphabet>;
+using GermanAlphabet = AlphabetUnion<LowercaseAlphabet, GermanLetterAlphabet>;
+using FrenchAlphabet = AlphabetUnion<LowercaseAlphabet, FrenchLetterAlphabet, ApostropheAlphabet>;
+
+
+
+// alphabetContains() returns true if the given byte appears in the given
+// alphabet's letters, with a single table lookup.  For an alphabet that
+// isn't all ASCII, that includes the bytes of its multi-byte letters.
+template <typename Alphabet>
+constexpr bool alphabetContains(char c) noexcept
+{
+    return impl_::Alphabet__table<Alphabet>::table[static_cast<unsigned char>(c)];
+}
+
+
+// alphabetIsAscii() returns true if every one of the given alphabet's
+// letters is a single byte.
+template <typename Alphabet>
+constexpr bool alphabetIsAscii() noexcept
+{
+    return impl_::Alphabet__codePoints<Alphabet>::COUNT == Alphabet::letters.size();
+}
+
+
+// alphabetCodePoints() returns the given alphabet's letters, each as the
+// UTF-8 bytes of one character.
+template <typename Alphabet>
+constexpr const auto& alphabetCodePoints() noexcept
+{
+    return impl_::Alphabet__codePoints<Alphabet>::codePoints;
+}
+
+
+
+#endif
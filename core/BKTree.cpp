@@ -0,0 +1,97 @@
+// BKTree.cpp
+
+#include "BKTree.hpp"
+#include <algorithm>
+#include "EditDistance.hpp"
+
+
+
+BKTree::BKTree()
+{
+}
+
+
+void BKTree::add(const std::string& word)
+{
+    if(nodes.empty()){
+        nodes.push_back(Node{word, {}});
+        return;
+    }
+
+    BitParallelDistance fromWord{word};
+    unsigned int current = 0;
+    while(true){
+        unsigned int distance = fromWord.levenshtein(nodes[current].word);
+        if(distance == 0){
+            return;
+        }
+
+        auto child = std::find_if(
+            nodes[current].children.begin(), nodes[current].children.end(),
+            [distance](const std::pair<unsigned int, unsigned int>& c) { return c.first == distance; });
+
+        if(child == nodes[current].children.end()){
+            nodes[current].children.emplace_back(distance, nodes.size());
+            nodes.push_back(Node{word, {}});
+            return;
+        }
+
+        current = child->second;
+    }
+}
+
+
+unsigned int BKTree::size() const noexcept
+{
+    return nodes.size();
+}
+
+
+std::vector<std::string> BKTree::findWithinDistance(
+    const std::string& word, unsigned int maxDistance) const
+{
+    std::vector<std::string> result;
+    if(nodes.empty()){
+        return result;
+    }
+
+    // Up to LANES pending nodes are taken at a time, so that the distances
+    // to their words can be measured together.
+    constexpr std::size_t LANES = BitParallelDistance::LANES;
+    BitParallelDistance fromWord{word};
+    const std::string* batch[LANES];
+    unsigned int batchNodes[LANES];
+    unsigned int distances[LANES];
+
+    std::vector<unsigned int> pending{0};
+    while(!pending.empty()){
+        std::size_t count = 0;
+        while(count < LANES && !pending.empty()){
+            batchNodes[count] = pending.back();
+            batch[count] = &nodes[pending.back()].word;
+            pending.pop_back();
+            count++;
+        }
+
+        fromWord.levenshtein(batch, count, distances);
+
+        for(std::size_t b = 0; b < count; b++){
+            const Node& node = nodes[batchNodes[b]];
+            unsigned int distance = distances[b];
+            if(distance <= maxDistance){
+                result.push_back(node.word);
+            }
+
+            unsigned int low = distance > maxDistance ? distance - maxDistance : 0;
+            unsigned int high = distance + maxDistance;
+            for(const auto& [childDistance, child] : node.children){
+                if(childDistance >= low && childDistance <= high){
+                    pending.push_back(child);
+                }
+            }
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
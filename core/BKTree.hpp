@@ -0,0 +1,65 @@
+// BKTree.hpp
+//
+// A BKTree (Burkhard-Keller tree) is a metric tree over a collection of
+// words, which finds every word within a given edit distance of a query
+// without comparing the query against all of them.
+//
+// Each node holds one word, and each of its children is labeled with that
+// child's Levenshtein distance from the node's word.  Because Levenshtein
+// distance obeys the triangle inequality, a query at distance d from a
+// node's word can only be within k of words in the subtrees labeled d-k
+// through d+k; the rest of the children are never visited.  This makes
+// distance 2 and 3 queries practical, where generating every candidate
+// string two or three edits away would not be.
+//
+// A BKTree can be built from any Set that can be walked, such as:
+//
+//     BKTree tree;
+//     avlSet.inorder([&](const std::string& word) { tree.add(word); });
+
+#ifndef BKTREE_HPP
+#define BKTREE_HPP
+
+#include <string>
+#include <utility>
+#include <vector>
+
+
+
+class BKTree
+{
+public:
+    // Initializes an empty BKTree.
+    BKTree();
+
+
+    // add() adds a word to the tree.  Adding a word that's already in the
+    // tree has no effect.
+    void add(const std::string& word);
+
+
+    // size() returns the number of words in the tree.
+    unsigned int size() const noexcept;
+
+
+    // findWithinDistance() returns, in sorted order, every word in the tree
+    // whose Levenshtein distance from the given word is at most maxDistance.
+    std::vector<std::string> findWithinDistance(
+        const std::string& word, unsigned int maxDistance) const;
+
+
+private:
+    struct Node
+    {
+        std::string word;
+
+        // Each child is a (distance, index into nodes) pair.
+        std::vector<std::pair<unsigned int, unsigned int>> children;
+    };
+
+    std::vector<Node> nodes;
+};
+
+
+
+#endif
@@ -0,0 +1,110 @@
+// BasicWordChecker.hpp
+//
+// A BasicWordChecker checks words and finds suggestions just as
+// WordChecker does, but against one concrete type of Set, chosen at
+// compile time.  WordChecker looks up every candidate through the virtual
+// Set<std::string>::contains(), which the compiler can't inline, so the
+// hash function or comparisons behind it are a separate call for each of
+// the hundreds of candidates per query.  BasicWordChecker<SetT> calls
+// SetT::contains() by its qualified name, which isn't a virtual call at
+// all, so the whole lookup can be inlined into the techniques' loops.
+//
+// Its alphabet is a template parameter too, rather than chosen with
+// useAlphabet().  It has none of WordChecker's optional indexes, caches
+// or other forms of findSuggestions(); it's meant for the hot path, where
+// the Set's type is known, e.g.,
+//
+//     HashSet<std::string, FnvHash> words{FnvHash{}};
+//     BasicWordChecker<HashSet<std::string, FnvHash>> checker{words};
+//
+// A SetT whose contains() takes a std::string_view, such as that one,
+// has the fifth technique's substrings looked up without copying them.
+
+#ifndef BASICWORDCHECKER_HPP
+#define BASICWORDCHECKER_HPP
+
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "Alphabet.hpp"
+#include "SuggestionCollector.hpp"
+#include "SuggestionTechniques.hpp"
+
+
+
+template <typename SetT, typename Alphabet = UppercaseAlphabet>
+class BasicWordChecker
+{
+    static_assert(!std::is_abstract_v<SetT>,
+        "BasicWordChecker needs a concrete Set; use WordChecker for Set<std::string>");
+
+public:
+    // The constructor requires a SetT of words to be passed into it.  The
+    // BasicWordChecker will store a reference to it, which it will use
+    // whenever it needs to look up a word.
+    explicit BasicWordChecker(const SetT& words);
+
+
+    // wordExists() returns true if the given word is spelled correctly,
+    // false otherwise.
+    bool wordExists(const std::string& word) const;
+
+
+    // findSuggestions() returns the same suggestions, in the same sorted
+    // order, as WordChecker::findSuggestions() would for the same words
+    // and alphabet.
+    std::vector<std::string> findSuggestions(const std::string& word) const;
+
+
+private:
+    const SetT& words;
+};
+
+
+
+template <typename SetT, typename Alphabet>
+BasicWordChecker<SetT, Alphabet>::BasicWordChecker(const SetT& words)
+    : words{words}
+{
+}
+
+
+template <typename SetT, typename Alphabet>
+bool BasicWordChecker<SetT, Alphabet>::wordExists(const std::string& word) const
+{
+    // The qualified name calls SetT's own contains(), without going
+    // through the vtable, even though it overrides a virtual function.
+    return words.SetT::contains(word);
+}
+
+
+template <typename SetT, typename Alphabet>
+std::vector<std::string> BasicWordChecker<SetT, Alphabet>::findSuggestions(const std::string& word) const
+{
+    // The return type rules out candidate types that SetT::contains()
+    // doesn't take, so forEachSplit() only passes std::string_views to a
+    // SetT that can look them up.
+    auto exists = [this](const auto& candidate) -> decltype(words.SetT::contains(candidate))
+    {
+        return words.SetT::contains(candidate);
+    };
+
+    SuggestionCollector collector;
+    auto insert = [&](const std::string& suggestion, SuggestionTechnique)
+    {
+        collector.add(suggestion);
+    };
+
+    if(alphabetIsAscii<Alphabet>() && isAsciiWord(word)){
+        forEachByteSuggestion<Alphabet>(word, exists, insert, UnlimitedBudget{});
+    }
+    else{
+        forEachCharacterSuggestion<Alphabet>(word, exists, insert, UnlimitedBudget{});
+    }
+
+    return collector.suggestions(SuggestionOrder::Sorted);
+}
+
+
+
+#endif
@@ -0,0 +1,83 @@
+// BloomFilter.cpp
+
+#include "BloomFilter.hpp"
+#include <algorithm>
+#include <cmath>
+
+
+
+namespace
+{
+    std::uint64_t bloomHash(const std::string& s) noexcept
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for(char c : s){
+            hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+        }
+
+        // FNV-1a alone mixes its last few characters poorly into the high
+        // bits, so finish with a murmur-style avalanche.
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ull;
+        hash ^= hash >> 33;
+        return hash;
+    }
+}
+
+
+BloomFilter::BloomFilter(unsigned int expectedElements, double falsePositiveRate)
+{
+    double n = std::max(expectedElements, 1u);
+    double p = std::min(std::max(falsePositiveRate, 1e-9), 0.5);
+    double ln2 = std::log(2.0);
+
+    double m = std::ceil(-n * std::log(p) / (ln2 * ln2));
+    bitsInFilter = std::max<std::uint64_t>(64, static_cast<std::uint64_t>(m));
+    hashes = std::max(1u, static_cast<unsigned int>(std::round(bitsInFilter / n * ln2)));
+
+    bits.assign((bitsInFilter + 63) / 64, 0);
+}
+
+
+void BloomFilter::add(const std::string& element)
+{
+    std::uint64_t hash = bloomHash(element);
+    std::uint64_t h1 = hash & 0xffffffffu;
+    std::uint64_t h2 = (hash >> 32) | 1;
+
+    for(unsigned int i = 0; i < hashes; i++){
+        std::uint64_t bit = (h1 + i * h2) % bitsInFilter;
+        bits[bit / 64] |= std::uint64_t{1} << (bit % 64);
+    }
+}
+
+
+bool BloomFilter::mightContain(const std::string& element) const noexcept
+{
+    std::uint64_t hash = bloomHash(element);
+    std::uint64_t h1 = hash & 0xffffffffu;
+    std::uint64_t h2 = (hash >> 32) | 1;
+
+    for(unsigned int i = 0; i < hashes; i++){
+        std::uint64_t bit = (h1 + i * h2) % bitsInFilter;
+        if((bits[bit / 64] & (std::uint64_t{1} << (bit % 64))) == 0){
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+std::uint64_t BloomFilter::bitCount() const noexcept
+{
+    return bitsInFilter;
+}
+
+
+unsigned int BloomFilter::hashCount() const noexcept
+{
+    return hashes;
+}
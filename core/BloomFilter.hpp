@@ -0,0 +1,61 @@
+// BloomFilter.hpp
+//
+// A BloomFilter is a compact, probabilistic summary of a set of strings.
+// mightContain() never returns false for a string that was added, but may
+// (with a chosen probability, the "false positive rate") return true for
+// one that wasn't.  In exchange, the whole filter is a small bit array
+// that stays in cache, and a check costs a handful of bit tests instead of
+// a walk through a hash chain, a tree path or a skip list tower.
+//
+// The filter is sized from the number of strings expected and the desired
+// false positive rate, using the usual formulas:
+//
+//     bits = -n ln(p) / (ln 2)^2        hashes = (bits / n) ln 2
+//
+// and each string's bit positions are derived from a single 64-bit hash
+// by double hashing.
+
+#ifndef BLOOMFILTER_HPP
+#define BLOOMFILTER_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+
+class BloomFilter
+{
+public:
+    // Initializes an empty BloomFilter sized so that, once it holds
+    // expectedElements strings, mightContain() returns true for a string
+    // that wasn't added with probability close to falsePositiveRate.
+    BloomFilter(unsigned int expectedElements, double falsePositiveRate);
+
+
+    // add() adds a string to the filter.
+    void add(const std::string& element);
+
+
+    // mightContain() returns false if the given string was definitely not
+    // added to the filter, and true if it probably was.
+    bool mightContain(const std::string& element) const noexcept;
+
+
+    // bitCount() returns the number of bits in the filter.
+    std::uint64_t bitCount() const noexcept;
+
+
+    // hashCount() returns the number of bits set for each string.
+    unsigned int hashCount() const noexcept;
+
+
+private:
+    std::vector<std::uint64_t> bits;
+    std::uint64_t bitsInFilter;
+    unsigned int hashes;
+};
+
+
+
+#endif
@@ -0,0 +1,125 @@
+// CorpusChecker.cpp
+
+#include "CorpusChecker.hpp"
+#include <memory>
+#include <mutex>
+#include "WorkStealingPool.hpp"
+
+
+
+CorpusChecker::CorpusChecker(const WordChecker& checker, unsigned int threadCount,
+                             std::size_t chunkSize, bool withSuggestions, WordCase wordCase)
+    : checker{checker}, threadCount{threadCount},
+      chunkSize{chunkSize == 0 ? DEFAULT_CHUNK_SIZE : chunkSize}, withSuggestions{withSuggestions},
+      wordCase{wordCase}
+{
+}
+
+
+unsigned long long CorpusChecker::checkFiles(const std::vector<std::string>& paths, CorpusVisitFunction visit) const
+{
+    struct Chunk
+    {
+        unsigned int file;
+        std::size_t begin;
+        std::size_t end;
+        bool lastInFile;
+        bool done;
+        unsigned long long words;
+        std::vector<Misspelling> misspellings;
+    };
+
+    std::vector<std::unique_ptr<MappedFile>> files;
+    std::vector<Chunk> chunks;
+
+    for(unsigned int f = 0; f < paths.size(); f++){
+        files.push_back(std::make_unique<MappedFile>(paths[f]));
+
+        std::vector<std::size_t> boundaries = chunkBoundaries(files.back()->contents(), chunkSize);
+        for(std::size_t b = 0; b + 1 < boundaries.size(); b++){
+            chunks.push_back(Chunk{f, boundaries[b], boundaries[b+1], b + 2 == boundaries.size(), false, 0, {}});
+        }
+    }
+
+    DocumentChecker document{checker, withSuggestions, wordCase};
+    WorkStealingPool pool{threadCount};
+
+    // Chunks are reported as soon as every chunk before them has been,
+    // by whichever worker finishes the one that completes the prefix.
+    // Only one worker reports at a time; a worker that finishes a chunk
+    // while another is reporting leaves it for that one to pick up.
+    std::mutex mutex;
+    std::size_t nextToReport = 0;
+    bool reporting = false;
+
+    pool.run(chunks.size(), [&](unsigned int c)
+    {
+        Chunk& chunk = chunks[c];
+        std::string_view text = files[chunk.file]->contents().substr(chunk.begin, chunk.end - chunk.begin);
+
+        chunk.words = document.checkText(text, [&](const Misspelling& misspelling)
+        {
+            chunk.misspellings.push_back(misspelling);
+        }, chunk.begin);
+
+        std::unique_lock<std::mutex> lock{mutex};
+        chunk.done = true;
+        if(reporting){
+            return;
+        }
+
+        reporting = true;
+        while(nextToReport < chunks.size() && chunks[nextToReport].done){
+            Chunk& ready = chunks[nextToReport];
+            lock.unlock();
+
+            for(const Misspelling& misspelling : ready.misspellings){
+                visit(ready.file, misspelling);
+            }
+            ready.misspellings = std::vector<Misspelling>{};
+
+            // Nothing refers to a file's mapping once its last chunk has
+            // been reported, so it can be unmapped without waiting for
+            // the rest of the corpus.
+            if(ready.lastInFile){
+                files[ready.file].reset();
+            }
+
+            lock.lock();
+            nextToReport++;
+        }
+        reporting = false;
+    });
+
+    unsigned long long words = 0;
+    for(const Chunk& chunk : chunks){
+        words += chunk.words;
+    }
+
+    return words;
+}
+
+
+std::vector<std::size_t> CorpusChecker::chunkBoundaries(std::string_view text, std::size_t chunkSize)
+{
+    using impl_::DocumentChecker__isWordByte;
+
+    std::vector<std::size_t> boundaries{0};
+
+    while(boundaries.back() < text.size()){
+        std::size_t cut = boundaries.back() + chunkSize;
+        if(cut >= text.size()){
+            boundaries.push_back(text.size());
+            break;
+        }
+
+        // Words are made of word bytes and apostrophes, so a cut at any
+        // other byte can't fall within one.
+        while(cut < text.size() && (DocumentChecker__isWordByte(text[cut]) || text[cut] == '\'')){
+            cut++;
+        }
+        boundaries.push_back(cut);
+    }
+
+    return boundaries;
+}
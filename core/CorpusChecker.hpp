@@ -0,0 +1,80 @@
+// CorpusChecker.hpp
+//
+// A CorpusChecker checks a whole corpus of files in parallel.  Each file is
+// memory-mapped and cut into chunks of roughly equal size, with every cut
+// moved forward to fall between words, and the chunks are checked with a
+// DocumentChecker on a WorkStealingPool.  The cost of a chunk depends
+// mostly on how many misspellings it holds (each needs suggestions), so
+// chunks vary widely in cost; work stealing keeps every worker busy until
+// the last chunk is done.
+//
+// Each chunk's misspellings are collected separately, and they're
+// reported in order: by file, then by offset within the file, exactly as
+// checking the files one after another would report them.  A chunk is
+// reported as soon as it and every chunk before it have been checked, and
+// a file is unmapped as soon as its last chunk has been reported, so
+// neither the misspellings nor the mappings pile up until the end.
+
+#ifndef CORPUSCHECKER_HPP
+#define CORPUSCHECKER_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+#include "DocumentChecker.hpp"
+#include "WordChecker.hpp"
+
+
+
+class CorpusChecker
+{
+public:
+    // A CorpusVisitFunction is called once for every misspelling, with the
+    // index of the file (in the vector given to checkFiles()) it's in.  It
+    // is called on whichever worker thread reports the misspelling, but
+    // never by two threads at once.  The misspelled word refers to the
+    // file's mapping, so it's only valid while the function is running.
+    using CorpusVisitFunction = std::function<void(unsigned int file, const Misspelling& misspelling)>;
+
+    // The default size of the chunks files are cut into.
+    static constexpr std::size_t DEFAULT_CHUNK_SIZE = 1 << 20;
+
+public:
+    // Initializes a CorpusChecker that checks with the given WordChecker,
+    // which it stores a reference to, on threadCount workers (0 meaning
+    // one per hardware core), cutting files into chunks of about chunkSize
+    // bytes.  Suggestions are found for each misspelling unless
+    // withSuggestions is false, and words are looked up in the given
+    // WordCase, as DocumentChecker does.
+    explicit CorpusChecker(const WordChecker& checker, unsigned int threadCount = 0,
+                           std::size_t chunkSize = DEFAULT_CHUNK_SIZE, bool withSuggestions = true,
+                           WordCase wordCase = WordCase::Uppercase);
+
+
+    // checkFiles() checks every word in every one of the given files,
+    // calling visit for each misspelling in order, and returns the number
+    // of words checked.  It throws a DocumentCheckerException if any of
+    // the files can't be mapped, before any of them are checked.  If visit
+    // throws, the remaining chunks are abandoned and the exception is
+    // rethrown.
+    unsigned long long checkFiles(const std::vector<std::string>& paths, CorpusVisitFunction visit) const;
+
+
+    // chunkBoundaries() returns the offsets at which the given text would
+    // be cut into chunks of about chunkSize bytes: the first is 0, the last
+    // is the text's size, and none falls within a word.
+    static std::vector<std::size_t> chunkBoundaries(std::string_view text, std::size_t chunkSize);
+
+
+private:
+    const WordChecker& checker;
+    unsigned int threadCount;
+    std::size_t chunkSize;
+    bool withSuggestions;
+    WordCase wordCase;
+};
+
+
+
+#endif
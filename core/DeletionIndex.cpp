@@ -0,0 +1,247 @@
+// DeletionIndex.cpp
+
+#include "DeletionIndex.hpp"
+#include <algorithm>
+#include "EditDistance.hpp"
+#include "SuggestionTechniques.hpp"
+
+
+
+namespace
+{
+    bool isSuggestedLetter(char c)
+    {
+        return c >= 'A' && c <= 'Z';
+    }
+
+
+    // sameFrom() returns true if a, starting at index i, is the same as b,
+    // starting at index j.
+    bool sameFrom(const std::string& a, std::size_t i, const std::string& b, std::size_t j)
+    {
+        return a.compare(std::min(i, a.size()), std::string::npos,
+                         b, std::min(j, b.size()), std::string::npos) == 0;
+    }
+
+
+    // isOneTechniqueAway() returns true if one of WordChecker's swap,
+    // insert, delete or replace techniques turns word into candidate.  This
+    // is a little narrower than an edit distance of 1, because WordChecker
+    // only ever inserts or replaces with the letters 'A' through 'Z', and
+    // because it suggests the word itself whenever swapping two equal
+    // neighbours or replacing a letter with itself leaves it unchanged.
+    bool isOneTechniqueAway(const std::string& word, const std::string& candidate)
+    {
+        std::size_t i = 0;
+        while(i < word.size() && i < candidate.size() && word[i] == candidate[i]){
+            i++;
+        }
+
+        if(candidate.size() == word.size()){
+            if(i == word.size()){
+                for(std::size_t j = 0; j < word.size(); j++){
+                    if(isSuggestedLetter(word[j]) || (j+1 < word.size() && word[j] == word[j+1])){
+                        return true;
+                    }
+                }
+                return false;
+            }
+            if(sameFrom(word, i+1, candidate, i+1)){
+                return isSuggestedLetter(candidate[i]);
+            }
+            return i+1 < word.size()
+                && word[i] == candidate[i+1] && word[i+1] == candidate[i]
+                && sameFrom(word, i+2, candidate, i+2);
+        }
+        else if(candidate.size() == word.size() + 1){
+            return isSuggestedLetter(candidate[i]) && sameFrom(candidate, i+1, word, i);
+        }
+        else if(candidate.size() + 1 == word.size()){
+            return sameFrom(word, i+1, candidate, i);
+        }
+
+        return false;
+    }
+
+
+    // Deletes are keyed by a 64-bit FNV-1a hash rather than by the strings
+    // themselves, which keeps the table a fraction of the size.  A rare
+    // collision only adds a candidate that then fails verification.
+    std::uint64_t deleteKey(const std::string& s)
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for(char c : s){
+            hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+        }
+        return hash;
+    }
+}
+
+
+DeletionIndex::DeletionIndex(unsigned int maxDistance)
+    : distance{maxDistance}
+{
+}
+
+
+void DeletionIndex::add(const std::string& word)
+{
+    if(wordIds.count(word) != 0){
+        return;
+    }
+
+    unsigned int id = dictionary.size();
+    dictionary.push_back(word);
+    wordIds.emplace(word, id);
+
+    std::unordered_set<std::string> neighbourhood{word};
+    addDeletes(word, distance, neighbourhood);
+
+    for(const std::string& key : neighbourhood){
+        deletes[deleteKey(key)].push_back(id);
+    }
+}
+
+
+bool DeletionIndex::contains(const std::string& word) const
+{
+    return wordIds.count(word) != 0;
+}
+
+
+unsigned int DeletionIndex::size() const noexcept
+{
+    return dictionary.size();
+}
+
+
+unsigned int DeletionIndex::maxDistance() const noexcept
+{
+    return distance;
+}
+
+
+std::vector<std::string> DeletionIndex::findSuggestions(const std::string& word) const
+{
+    // The word's own deletes are looked up as they're made, by editing one
+    // scratch copy of the word in place, so the query never builds its
+    // neighbourhood as a set of separate strings.  Several deletes usually
+    // lead back to the same dictionary word, so the candidates are
+    // deduplicated before each one is verified.
+    std::vector<unsigned int> candidates;
+    std::string scratch = word;
+    collectCandidates(scratch, distance, candidates);
+
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    // The cheap one-technique check settles most candidates; the rest are
+    // measured together with a BitParallelDistance.
+    std::vector<std::string> result;
+    std::vector<const std::string*> unsettled;
+    for(unsigned int id : candidates){
+        const std::string& candidate = dictionary[id];
+        if(isOneTechniqueAway(word, candidate)){
+            result.push_back(candidate);
+        }
+        else if(distance >= 2){
+            unsettled.push_back(&candidate);
+        }
+    }
+
+    if(!unsettled.empty()){
+        std::vector<unsigned int> distances(unsettled.size());
+        BitParallelDistance{word}.damerau(unsettled.data(), unsettled.size(), distances.data());
+        for(std::size_t i = 0; i < unsettled.size(); i++){
+            if(distances[i] == 2){
+                result.push_back(*unsettled[i]);
+            }
+        }
+    }
+
+    // The split technique isn't an edit, so it's still done by lookups.
+    forEachSplit(word, [this](const std::string& part)
+    {
+        return contains(part);
+    }, [&](const std::string& split, SuggestionTechnique)
+    {
+        result.push_back(split);
+    }, UnlimitedBudget{});
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+
+bool DeletionIndex::mightHaveNeighbours(const std::string& word) const
+{
+    // A word one edit away shares a delete with the given one: the given
+    // word itself, when the edit is an insertion or deletion, or one of its
+    // single deletes at the edited position, when it's a replacement or a
+    // swap.  Every word's own deletes are in the table, so looking up the
+    // given word's deletes is enough to find any such word.
+    if(deletes.count(deleteKey(word)) != 0){
+        return true;
+    }
+
+    std::string scratch = word;
+    for(std::size_t i = 0; i < word.size(); i++){
+        if(i > 0 && word[i] == word[i-1]){
+            continue;
+        }
+
+        scratch.erase(i, 1);
+        bool found = deletes.count(deleteKey(scratch)) != 0;
+        scratch.insert(i, 1, word[i]);
+
+        if(found){
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+void DeletionIndex::collectCandidates(std::string& scratch, unsigned int depth,
+                                      std::vector<unsigned int>& candidates) const
+{
+    auto found = deletes.find(deleteKey(scratch));
+    if(found != deletes.end()){
+        candidates.insert(candidates.end(), found->second.begin(), found->second.end());
+    }
+
+    if(depth == 0){
+        return;
+    }
+
+    for(std::size_t i = 0; i < scratch.size(); i++){
+        // Deleting any character in a run of equal ones gives the same
+        // string, so only the first in each run is deleted.
+        if(i > 0 && scratch[i] == scratch[i-1]){
+            continue;
+        }
+
+        char deleted = scratch[i];
+        scratch.erase(i, 1);
+        collectCandidates(scratch, depth - 1, candidates);
+        scratch.insert(i, 1, deleted);
+    }
+}
+
+
+void DeletionIndex::addDeletes(const std::string& word, unsigned int depth,
+                               std::unordered_set<std::string>& neighbourhood) const
+{
+    if(depth == 0){
+        return;
+    }
+
+    for(std::size_t i = 0; i < word.size(); i++){
+        std::string shorter = word;
+        shorter.erase(i, 1);
+        if(neighbourhood.insert(shorter).second){
+            addDeletes(shorter, depth - 1, neighbourhood);
+        }
+    }
+}
@@ -0,0 +1,90 @@
+// DeletionIndex.hpp
+//
+// A DeletionIndex is a suggestion engine that can be used alongside (or
+// instead of) a WordChecker.  It trades memory and build time for much
+// faster suggestions, using the approach popularized by SymSpell: when a
+// word is added, every string that can be made by deleting up to
+// maxDistance of its characters (its "delete-neighbourhood") is recorded in
+// a hash table, pointing back at the word.
+//
+// Two words are within a small edit distance of one another only if their
+// delete-neighbourhoods share a string, so findSuggestions() only needs to
+// generate the deletes of the misspelled word and look each one up.  The
+// 26 * (n + 1) insertions and replacements that WordChecker generates are
+// never built.  Each word found this way is then checked against the
+// actual edit distance, since sharing a delete is necessary but not
+// sufficient.
+//
+// With a maxDistance of 1, findSuggestions() returns exactly what
+// WordChecker::findSuggestions() would for the same words.  With a
+// maxDistance of 2, it also returns every word that is two edits (counting
+// a swap of adjacent characters as one edit) away.
+
+#ifndef DELETIONINDEX_HPP
+#define DELETIONINDEX_HPP
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+
+
+class DeletionIndex
+{
+public:
+    // Initializes an empty DeletionIndex that finds suggestions up to the
+    // given edit distance, which should be 1 or 2.
+    explicit DeletionIndex(unsigned int maxDistance = 1);
+
+
+    // add() adds a word to the index, along with its delete-neighbourhood.
+    // Adding a word that's already in the index has no effect.
+    void add(const std::string& word);
+
+
+    // contains() returns true if the given word has been added to the index.
+    bool contains(const std::string& word) const;
+
+
+    // size() returns the number of words in the index.
+    unsigned int size() const noexcept;
+
+
+    // maxDistance() returns the edit distance the index was built for.
+    unsigned int maxDistance() const noexcept;
+
+
+    // findSuggestions() returns, in sorted order, the words in the index
+    // (and pairs of words separated by a space) that are suggested for the
+    // given word.
+    std::vector<std::string> findSuggestions(const std::string& word) const;
+
+
+    // mightHaveNeighbours() returns false if no word in the index can be
+    // made from the given one by a single swap, insertion, deletion or
+    // replacement of a byte.  It only looks up the word and its own
+    // single deletes, without verifying anything, so it can return true
+    // when there are no such words, but never false when there are.  This
+    // makes it a cheap filter for strings that aren't worth editing
+    // further.
+    bool mightHaveNeighbours(const std::string& word) const;
+
+
+private:
+    void addDeletes(const std::string& word, unsigned int depth,
+                    std::unordered_set<std::string>& neighbourhood) const;
+
+    void collectCandidates(std::string& scratch, unsigned int depth,
+                           std::vector<unsigned int>& candidates) const;
+
+    unsigned int distance;
+    std::vector<std::string> dictionary;
+    std::unordered_map<std::string, unsigned int> wordIds;
+    std::unordered_map<std::uint64_t, std::vector<unsigned int>> deletes;
+};
+
+
+
+#endif
@@ -0,0 +1,156 @@
+// DocumentChecker.cpp
+
+#include "DocumentChecker.hpp"
+#include <cerrno>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+
+DocumentCheckerException::DocumentCheckerException(const std::string& reason)
+    : reason_{reason}
+{
+}
+
+
+const std::string& DocumentCheckerException::reason() const noexcept
+{
+    return reason_;
+}
+
+
+#if defined(_WIN32)
+
+// Without mmap(), the file is read into a heap buffer instead.
+MappedFile::MappedFile(const std::string& path)
+{
+    std::ifstream in{path, std::ios::binary | std::ios::ate};
+    if(!in){
+        throw DocumentCheckerException{"cannot open " + path};
+    }
+
+    // Opening at the end gives the file's size, so it can be read
+    // straight into a buffer of the right length.
+    length = static_cast<std::size_t>(in.tellg());
+    char* buffer = new char[length + 1];
+    in.seekg(0);
+    if(!in.read(buffer, static_cast<std::streamsize>(length))){
+        delete[] buffer;
+        throw DocumentCheckerException{"cannot read " + path};
+    }
+    data = buffer;
+}
+
+
+MappedFile::~MappedFile() noexcept
+{
+    delete[] data;
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path)
+    : data{nullptr}, length{0}
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if(fd < 0){
+        throw DocumentCheckerException{"cannot open " + path + ": " + std::strerror(errno)};
+    }
+
+    struct stat info;
+    if(fstat(fd, &info) != 0){
+        int error = errno;
+        close(fd);
+        throw DocumentCheckerException{"cannot stat " + path + ": " + std::strerror(error)};
+    }
+
+    length = static_cast<std::size_t>(info.st_size);
+
+    // An empty file can't be mapped, but there's nothing to check anyway.
+    if(length > 0){
+        void* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(mapping == MAP_FAILED){
+            int error = errno;
+            close(fd);
+            throw DocumentCheckerException{"cannot map " + path + ": " + std::strerror(error)};
+        }
+
+        // The text is read once, front to back, so the kernel can read
+        // ahead aggressively and drop pages behind us.
+        madvise(mapping, length, MADV_SEQUENTIAL);
+        data = static_cast<const char*>(mapping);
+    }
+
+    close(fd);
+}
+
+
+MappedFile::~MappedFile() noexcept
+{
+    if(data != nullptr){
+        munmap(const_cast<char*>(data), length);
+    }
+}
+
+#endif
+
+
+std::string_view MappedFile::contents() const noexcept
+{
+    return std::string_view{data, length};
+}
+
+
+DocumentChecker::DocumentChecker(const WordChecker& checker, bool withSuggestions, WordCase wordCase)
+    : checker{checker}, withSuggestions{withSuggestions}, wordCase{wordCase}
+{
+}
+
+
+unsigned long long DocumentChecker::checkFile(const std::string& path, MisspellingVisitFunction visit) const
+{
+    MappedFile file{path};
+    return checkText(file.contents(), visit);
+}
+
+
+unsigned long long DocumentChecker::checkText(std::string_view text, MisspellingVisitFunction visit,
+                                              std::size_t baseOffset) const
+{
+    unsigned long long count = 0;
+    std::string scratch;
+    Misspelling misspelling;
+
+    forEachWord(text, [&](std::size_t offset, std::string_view word)
+    {
+        count++;
+        scratch.assign(word.data(), word.size());
+        if(wordCase == WordCase::Uppercase){
+            for(char& c : scratch){
+                if(c >= 'a' && c <= 'z'){
+                    c = static_cast<char>(c - 'a' + 'A');
+                }
+            }
+        }
+
+        if(!checker.wordExists(scratch)){
+            misspelling.offset = baseOffset + offset;
+            misspelling.word = word;
+            if(withSuggestions){
+                misspelling.suggestions = checker.findSuggestions(scratch);
+            }
+            visit(misspelling);
+        }
+    });
+
+    return count;
+}
+
@@ -0,0 +1,183 @@
+// DocumentChecker.hpp
+//
+// A DocumentChecker runs a WordChecker over a whole document, reporting
+// each misspelled word it finds, along with where the word appears and
+// what WordChecker::findSuggestions() suggests for it.
+//
+// Files are memory-mapped rather than read, and the text is split into
+// words in place: each word is a std::string_view into the mapping, so the
+// document is never copied into std::strings.  (The only copy is of each
+// word, in turn, into one reused buffer, since Set::contains() needs a
+// std::string to look up; that buffer stops allocating once it has grown
+// to the length of the longest word.)  Misspellings are reported through a
+// visit function as they're found, so arbitrarily large files can be
+// checked in constant memory.
+//
+// A word is a run of ASCII letters and bytes of multi-byte UTF-8
+// characters, possibly with apostrophes between them (as in "DON'T");
+// everything else separates words.  Lookups are case-sensitive, and the
+// project's dictionary is uppercase, so by default each word's ASCII
+// letters are uppercased as it's copied into the buffer (see WordCase).
+
+#ifndef DOCUMENTCHECKER_HPP
+#define DOCUMENTCHECKER_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "WordChecker.hpp"
+
+
+
+// A Misspelling is one misspelled word found in a document.  The word
+// refers to the document's text, so it's only valid while the visit
+// function is running.
+struct Misspelling
+{
+    std::size_t offset;
+    std::string_view word;
+    std::vector<std::string> suggestions;
+};
+
+
+
+// WordCase says what a DocumentChecker does to the case of each word
+// before looking it up: leave it as written in the document (for a
+// dictionary in lowercase or mixed case), or uppercase its ASCII letters
+// (for an uppercase dictionary, like the project's words.txt).  Bytes of
+// multi-byte UTF-8 characters are never changed.
+enum class WordCase
+{
+    AsWritten,
+    Uppercase
+};
+
+
+
+class DocumentCheckerException
+{
+public:
+    explicit DocumentCheckerException(const std::string& reason);
+
+    const std::string& reason() const noexcept;
+
+private:
+    std::string reason_;
+};
+
+
+
+// A MappedFile is a read-only memory mapping of a file's contents, which
+// is unmapped when the MappedFile is destroyed.
+class MappedFile
+{
+public:
+    // Maps the file at the given path, throwing a DocumentCheckerException
+    // if it can't be opened or mapped.
+    explicit MappedFile(const std::string& path);
+
+    ~MappedFile() noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+
+    // contents() returns the file's contents.
+    std::string_view contents() const noexcept;
+
+
+private:
+    const char* data;
+    std::size_t length;
+};
+
+
+
+class DocumentChecker
+{
+public:
+    // A MisspellingVisitFunction is called once for every misspelling.
+    using MisspellingVisitFunction = std::function<void(const Misspelling&)>;
+
+public:
+    // Initializes a DocumentChecker that uses the given WordChecker, which
+    // it stores a reference to.  If withSuggestions is false, misspellings
+    // are reported without calling findSuggestions(), which is much faster
+    // when only their locations are needed.  Words are looked up (and
+    // given to findSuggestions()) in the given WordCase; the Misspelling's
+    // word is always as written.
+    explicit DocumentChecker(const WordChecker& checker, bool withSuggestions = true,
+                             WordCase wordCase = WordCase::Uppercase);
+
+
+    // checkFile() memory-maps the file at the given path and checks every
+    // word in it, calling visit for each misspelling, in order.  Offsets
+    // are in bytes from the start of the file.  It returns the number of
+    // words checked, and throws a DocumentCheckerException if the file
+    // can't be mapped.
+    unsigned long long checkFile(const std::string& path, MisspellingVisitFunction visit) const;
+
+
+    // checkText() checks every word in the given text in the same way.
+    // Offsets are in bytes from the start of the text, plus baseOffset.
+    unsigned long long checkText(std::string_view text, MisspellingVisitFunction visit,
+                                 std::size_t baseOffset = 0) const;
+
+
+    // forEachWord() calls visit(offset, word) for every word in the given
+    // text, splitting it into words as checkText() does.
+    template <typename Visit>
+    static void forEachWord(std::string_view text, Visit visit);
+
+
+private:
+    const WordChecker& checker;
+    bool withSuggestions;
+    WordCase wordCase;
+};
+
+
+
+namespace impl_
+{
+    inline bool DocumentChecker__isWordByte(char c) noexcept
+    {
+        unsigned char u = static_cast<unsigned char>(c);
+        return (u >= 'A' && u <= 'Z') || (u >= 'a' && u <= 'z') || u >= 0x80;
+    }
+}
+
+
+template <typename Visit>
+void DocumentChecker::forEachWord(std::string_view text, Visit visit)
+{
+    using impl_::DocumentChecker__isWordByte;
+
+    std::size_t i = 0;
+    std::size_t n = text.size();
+
+    while(i < n){
+        while(i < n && !DocumentChecker__isWordByte(text[i])){
+            i++;
+        }
+
+        // An apostrophe only belongs to a word when it's between two
+        // word characters.
+        std::size_t start = i;
+        while(i < n && (DocumentChecker__isWordByte(text[i])
+                        || (text[i] == '\'' && i > start && i + 1 < n
+                            && DocumentChecker__isWordByte(text[i+1])))){
+            i++;
+        }
+
+        if(i > start){
+            visit(start, text.substr(start, i - start));
+        }
+    }
+}
+
+
+
+#endif
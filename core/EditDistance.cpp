@@ -0,0 +1,235 @@
+// EditDistance.cpp
+
+#include "EditDistance.hpp"
+#include <algorithm>
+#include <vector>
+
+
+
+unsigned int levenshteinDistance(const std::string& a, const std::string& b)
+{
+    // Only the previous row of the usual dynamic programming table is
+    // needed to compute the next one.
+    std::vector<unsigned int> row(b.size() + 1);
+
+    for(std::size_t j = 0; j <= b.size(); j++){
+        row[j] = j;
+    }
+
+    for(std::size_t i = 1; i <= a.size(); i++){
+        unsigned int diagonal = row[0];
+        row[0] = i;
+
+        for(std::size_t j = 1; j <= b.size(); j++){
+            unsigned int above = row[j];
+            row[j] = std::min({
+                above + 1,
+                row[j-1] + 1,
+                diagonal + (a[i-1] == b[j-1] ? 0 : 1)});
+            diagonal = above;
+        }
+    }
+
+    return row[b.size()];
+}
+
+
+unsigned int damerauDistance(const std::string& a, const std::string& b)
+{
+    // A swap looks two rows back, so three rows are kept.
+    std::vector<unsigned int> twoBack(b.size() + 1);
+    std::vector<unsigned int> previous(b.size() + 1);
+    std::vector<unsigned int> current(b.size() + 1);
+
+    for(std::size_t j = 0; j <= b.size(); j++){
+        previous[j] = j;
+    }
+
+    for(std::size_t i = 1; i <= a.size(); i++){
+        current[0] = i;
+
+        for(std::size_t j = 1; j <= b.size(); j++){
+            current[j] = std::min({
+                previous[j] + 1,
+                current[j-1] + 1,
+                previous[j-1] + (a[i-1] == b[j-1] ? 0 : 1)});
+
+            if(i > 1 && j > 1 && a[i-1] == b[j-2] && a[i-2] == b[j-1]){
+                current[j] = std::min(current[j], twoBack[j-2] + 1);
+            }
+        }
+
+        std::swap(twoBack, previous);
+        std::swap(previous, current);
+    }
+
+    return previous[b.size()];
+}
+
+
+
+BitParallelDistance::BitParallelDistance(const std::string& word)
+    : word{word}, matches{}
+{
+    if(word.size() <= 64){
+        for(std::size_t i = 0; i < word.size(); i++){
+            matches[static_cast<unsigned char>(word[i])] |= std::uint64_t{1} << i;
+        }
+    }
+}
+
+
+unsigned int BitParallelDistance::levenshtein(const std::string& other) const
+{
+    return distance<false>(other);
+}
+
+
+unsigned int BitParallelDistance::damerau(const std::string& other) const
+{
+    return distance<true>(other);
+}
+
+
+void BitParallelDistance::levenshtein(
+    const std::string* const* others, std::size_t count, unsigned int* distances) const
+{
+    this->distances<false>(others, count, distances);
+}
+
+
+void BitParallelDistance::damerau(
+    const std::string* const* others, std::size_t count, unsigned int* distances) const
+{
+    this->distances<true>(others, count, distances);
+}
+
+
+template <bool Swaps>
+unsigned int BitParallelDistance::distance(const std::string& other) const
+{
+    if(word.size() > 64){
+        return Swaps ? damerauDistance(word, other) : levenshteinDistance(word, other);
+    }
+    if(word.empty()){
+        return other.size();
+    }
+
+    // Bit i of positive (negative) is set when the table's entry in row
+    // i+1 of the current column is one more (less) than the one above it;
+    // the score is the entry in the last row, which is the distance once
+    // the last column is reached.
+    const std::uint64_t last = std::uint64_t{1} << (word.size() - 1);
+    std::uint64_t positive = ~std::uint64_t{0};
+    std::uint64_t negative = 0;
+    std::uint64_t previousDiagonal = 0;
+    std::uint64_t previousMatches = 0;
+    unsigned int score = word.size();
+
+    for(char c : other){
+        std::uint64_t match = matches[static_cast<unsigned char>(c)];
+
+        // Bit i of diagonal is set when the entry in row i+1 is the same
+        // as the one diagonally above and to the left of it.
+        std::uint64_t diagonal = (((match & positive) + positive) ^ positive) | match | negative;
+        if(Swaps){
+            diagonal |= ((~previousDiagonal & match) << 1) & previousMatches;
+        }
+
+        std::uint64_t horizontalPositive = negative | ~(diagonal | positive);
+        std::uint64_t horizontalNegative = positive & diagonal;
+
+        score += (horizontalPositive & last) != 0;
+        score -= (horizontalNegative & last) != 0;
+
+        horizontalPositive = (horizontalPositive << 1) | 1;
+        horizontalNegative <<= 1;
+        positive = horizontalNegative | ~(diagonal | horizontalPositive);
+        negative = horizontalPositive & diagonal;
+
+        previousDiagonal = diagonal;
+        previousMatches = match;
+    }
+
+    return score;
+}
+
+
+template <bool Swaps>
+void BitParallelDistance::distances(
+    const std::string* const* others, std::size_t count, unsigned int* distances) const
+{
+    if(word.size() > 64 || word.empty()){
+        for(std::size_t i = 0; i < count; i++){
+            distances[i] = distance<Swaps>(*others[i]);
+        }
+        return;
+    }
+
+    // The same steps as distance(), for LANES words at a time.  Each step
+    // is written as a loop over the lanes, with no branches in it, so the
+    // compiler can turn it into vector instructions.  A lane whose word
+    // has run out goes on stepping over nothing, which changes its state,
+    // so its score is captured at the step where its word ends.
+    constexpr std::size_t L = LANES;
+    const unsigned int shift = word.size() - 1;
+
+    for(std::size_t first = 0; first < count; first += L){
+        std::size_t lanes = std::min(L, count - first);
+
+        const char* text[L];
+        std::size_t length[L];
+        std::uint64_t positive[L];
+        std::uint64_t negative[L];
+        std::uint64_t previousDiagonal[L];
+        std::uint64_t previousMatches[L];
+        std::uint64_t score[L];
+        std::uint64_t final[L];
+        std::size_t longest = 0;
+
+        for(std::size_t l = 0; l < L; l++){
+            text[l] = l < lanes ? others[first + l]->data() : nullptr;
+            length[l] = l < lanes ? others[first + l]->size() : 0;
+            positive[l] = ~std::uint64_t{0};
+            negative[l] = 0;
+            previousDiagonal[l] = 0;
+            previousMatches[l] = 0;
+            score[l] = word.size();
+            final[l] = word.size();
+            longest = std::max(longest, length[l]);
+        }
+
+        for(std::size_t j = 0; j < longest; j++){
+            std::uint64_t match[L];
+            for(std::size_t l = 0; l < L; l++){
+                match[l] = j < length[l] ? matches[static_cast<unsigned char>(text[l][j])] : 0;
+            }
+
+            for(std::size_t l = 0; l < L; l++){
+                std::uint64_t diagonal = (((match[l] & positive[l]) + positive[l]) ^ positive[l]) | match[l] | negative[l];
+                if(Swaps){
+                    diagonal |= ((~previousDiagonal[l] & match[l]) << 1) & previousMatches[l];
+                }
+
+                std::uint64_t horizontalPositive = negative[l] | ~(diagonal | positive[l]);
+                std::uint64_t horizontalNegative = positive[l] & diagonal;
+
+                score[l] += (horizontalPositive >> shift) & 1;
+                score[l] -= (horizontalNegative >> shift) & 1;
+
+                horizontalPositive = (horizontalPositive << 1) | 1;
+                horizontalNegative <<= 1;
+                positive[l] = horizontalNegative | ~(diagonal | horizontalPositive);
+                negative[l] = horizontalPositive & diagonal;
+                previousDiagonal[l] = diagonal;
+                previousMatches[l] = match[l];
+
+                final[l] = j + 1 == length[l] ? score[l] : final[l];
+            }
+        }
+
+        for(std::size_t l = 0; l < lanes; l++){
+            distances[first + l] = final[l];
+        }
+    }
+}
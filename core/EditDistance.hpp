@@ -0,0 +1,78 @@
+// EditDistance.hpp
+//
+// Functions that measure how far apart two words are, in terms of the
+// single-character edits that WordChecker's suggestion techniques make.
+//
+// levenshteinDistance() counts insertions, deletions and replacements.
+// damerauDistance() additionally counts a swap of two adjacent characters
+// as a single edit (the "optimal string alignment" form of the distance,
+// in which no substring is edited more than once).
+//
+// Both functions fill in the usual dynamic programming table a row at a
+// time, which takes O(nm) steps.  A BitParallelDistance computes the same
+// distances from one word to many others much faster: it packs a whole
+// column of the table into the bits of a 64-bit integer and advances it a
+// column at a time with a few bitwise operations (Myers' algorithm, in
+// Hyyrö's formulation, which also handles swaps), and it can advance the
+// columns for several other words at once.
+
+#ifndef EDITDISTANCE_HPP
+#define EDITDISTANCE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+
+unsigned int levenshteinDistance(const std::string& a, const std::string& b);
+
+unsigned int damerauDistance(const std::string& a, const std::string& b);
+
+
+
+class BitParallelDistance
+{
+public:
+    // The number of words the batch forms of levenshtein() and damerau()
+    // advance together.
+    static constexpr std::size_t LANES = 4;
+
+public:
+    // Initializes a BitParallelDistance that measures distances from the
+    // given word.  Words of more than 64 bytes don't fit in one column, so
+    // distances from them are computed by levenshteinDistance() and
+    // damerauDistance() instead.
+    explicit BitParallelDistance(const std::string& word);
+
+
+    // levenshtein() and damerau() return the same distance from this
+    // object's word to the given one as levenshteinDistance() and
+    // damerauDistance() would.
+    unsigned int levenshtein(const std::string& other) const;
+    unsigned int damerau(const std::string& other) const;
+
+
+    // The batch forms store, in distances[i], the distance from this
+    // object's word to *others[i], for each of the count words given.
+    void levenshtein(const std::string* const* others, std::size_t count, unsigned int* distances) const;
+    void damerau(const std::string* const* others, std::size_t count, unsigned int* distances) const;
+
+
+private:
+    template <bool Swaps>
+    unsigned int distance(const std::string& other) const;
+
+    template <bool Swaps>
+    void distances(const std::string* const* others, std::size_t count, unsigned int* distances) const;
+
+    std::string word;
+
+    // matches[c] has bit i set when the word's ith byte is c.
+    std::array<std::uint64_t, 256> matches;
+};
+
+
+
+#endif
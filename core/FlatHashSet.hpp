@@ -0,0 +1,481 @@
+// FlatHashSet.hpp
+//
+// A FlatHashSet is an implementation of a Set that is an open-addressing
+// hash table in the style of Abseil's "Swiss tables".  Where a HashSet
+// allocates a node for every element and follows a chain of pointers on
+// every lookup, a FlatHashSet stores its elements inline, in one array of
+// slots, alongside an array of one-byte control values: one per slot,
+// either EMPTY or seven bits of the hash of the element in that slot.
+//
+// The slots are divided into groups of 16.  A lookup hashes its element
+// once, uses part of the hash to choose a group, and compares all 16 of
+// that group's control bytes with the element's seven bits at once; only
+// the slots whose bytes match have their elements compared.  If the group
+// has an empty slot, the element isn't in the set; otherwise, the lookup
+// moves on to another group, following a triangular sequence that visits
+// every group.  So a miss (the common case when looking up candidate
+// suggestions) usually costs one hash, one comparison of 16 bytes and no
+// element comparisons at all.  With SSE2, the 16 bytes are compared in two
+// instructions; without it, the same masks are computed a byte at a time.
+//
+// The table doubles in size whenever it would become more than 7/8 full,
+// and the number of groups is always a power of two.
+
+#ifndef FLATHASHSET_HPP
+#define FLATHASHSET_HPP
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+#include "Set.hpp"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+
+
+namespace impl_
+{
+    constexpr unsigned int FlatHashSet__GROUP_WIDTH = 16;
+    constexpr signed char FlatHashSet__EMPTY = -128;
+
+
+    // Bit i of the result is set if byte i of the group equals h2.
+    inline unsigned int FlatHashSet__match(const signed char* group, signed char h2) noexcept
+    {
+#ifdef __SSE2__
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(h2))));
+#else
+        unsigned int mask = 0;
+        for(unsigned int i = 0; i < FlatHashSet__GROUP_WIDTH; i++){
+            if(group[i] == h2){
+                mask |= 1u << i;
+            }
+        }
+        return mask;
+#endif
+    }
+
+
+    // Bit i of the result is set if slot i of the group is empty.  EMPTY
+    // is the only control value with its high bit set.
+    inline unsigned int FlatHashSet__matchEmpty(const signed char* group) noexcept
+    {
+#ifdef __SSE2__
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<unsigned int>(_mm_movemask_epi8(bytes));
+#else
+        unsigned int mask = 0;
+        for(unsigned int i = 0; i < FlatHashSet__GROUP_WIDTH; i++){
+            if(group[i] < 0){
+                mask |= 1u << i;
+            }
+        }
+        return mask;
+#endif
+    }
+
+
+    inline unsigned int FlatHashSet__lowestBit(unsigned int mask) noexcept
+    {
+#if defined(__GNUC__)
+        return static_cast<unsigned int>(__builtin_ctz(mask));
+#else
+        unsigned int bit = 0;
+        while((mask & 1u) == 0){
+            mask >>= 1;
+            bit++;
+        }
+        return bit;
+#endif
+    }
+}
+
+
+
+template <typename ElementType>
+class FlatHashSet : public Set<ElementType>
+{
+public:
+    // The number of slots in each group, whose control bytes are compared
+    // all at once.
+    static constexpr unsigned int GROUP_WIDTH = impl_::FlatHashSet__GROUP_WIDTH;
+
+    // A HashFunction is a function that takes a reference to a const
+    // ElementType and returns an unsigned int.
+    using HashFunction = std::function<unsigned int(const ElementType&)>;
+
+public:
+    // Initializes a FlatHashSet to be empty, with a single group of slots,
+    // so that it will use the given hash function whenever it needs to
+    // hash an element.  The hash is mixed before it is used, so a simple
+    // hash function is fine, but a constant one makes every lookup probe
+    // every group.
+    explicit FlatHashSet(HashFunction hashFunction);
+
+    // Cleans up the FlatHashSet so that it leaks no memory.
+    ~FlatHashSet() noexcept override;
+
+    // Initializes a new FlatHashSet to be a copy of an existing one.
+    FlatHashSet(const FlatHashSet& s);
+
+    // Initializes a new FlatHashSet whose contents, slots and hash function
+    // are moved from an expiring one.  The expiring one is left empty, with
+    // no slots and no hash function, so moving never allocates; it can be
+    // destroyed, assigned to, copied or queried, but it must be assigned
+    // to before anything is added to it.
+    FlatHashSet(FlatHashSet&& s) noexcept;
+
+    // Assigns an existing FlatHashSet into another.
+    FlatHashSet& operator=(const FlatHashSet& s);
+
+    // Assigns an expiring FlatHashSet into another.
+    FlatHashSet& operator=(FlatHashSet&& s) noexcept;
+
+
+    bool isImplemented() const noexcept override;
+
+
+    // add() adds an element to the set.  If the element is already in the
+    // set, this function has no effect.  When the set would become more
+    // than 7/8 full, its capacity is doubled first, which moves (rather
+    // than copies) every element into the new slots.
+    void add(const ElementType& element) override;
+
+
+    // contains() returns true if the given element is already in the set,
+    // false otherwise.
+    bool contains(const ElementType& element) const override;
+
+
+    // size() returns the number of elements in the set.
+    unsigned int size() const noexcept override;
+
+
+    // groupCount() returns the number of groups of GROUP_WIDTH slots in
+    // the table.
+    unsigned int groupCount() const noexcept;
+
+
+    // elementsInGroup() returns the number of elements stored in a
+    // particular group.  If the group is out of the boundaries of the
+    // table, this function returns 0.
+    unsigned int elementsInGroup(unsigned int group) const;
+
+
+    // groupsProbed() returns the number of groups whose control bytes a
+    // lookup of the given element examines, whether or not the element
+    // is in the set.  It's 1 unless the element's first group is full (or
+    // 0 if the set has been moved from, and so has no groups).
+    unsigned int groupsProbed(const ElementType& element) const;
+
+
+private:
+    struct Probe
+    {
+        // The slot holding the element if it was found, otherwise the
+        // first empty slot in the probe sequence, where it would go.
+        unsigned int slot;
+        bool found;
+        unsigned int groupsProbed;
+    };
+
+    std::uint64_t mix(const ElementType& element) const;
+    Probe probe(const ElementType& element, std::uint64_t mixed) const;
+    unsigned int findEmptySlot(std::uint64_t mixed) const noexcept;
+    void allocate(unsigned int newGroups);
+    void release() noexcept;
+    void grow();
+    void swap(FlatHashSet& s) noexcept;
+
+    signed char* control;
+    ElementType* slots;
+    unsigned int groups;
+    unsigned int sz;
+    HashFunction hashFunction;
+};
+
+
+
+template <typename ElementType>
+FlatHashSet<ElementType>::FlatHashSet(HashFunction hashFunction)
+    : control{nullptr}, slots{nullptr}, groups{0}, sz{0}, hashFunction{std::move(hashFunction)}
+{
+    allocate(1);
+}
+
+
+template <typename ElementType>
+FlatHashSet<ElementType>::~FlatHashSet() noexcept
+{
+    release();
+}
+
+
+template <typename ElementType>
+FlatHashSet<ElementType>::FlatHashSet(const FlatHashSet& s)
+    : control{nullptr}, slots{nullptr}, groups{0}, sz{0}, hashFunction{s.hashFunction}
+{
+    if(s.groups == 0){
+        return;
+    }
+
+    allocate(s.groups);
+
+    try{
+        for(unsigned int i = 0; i < groups * GROUP_WIDTH; i++){
+            if(s.control[i] != impl_::FlatHashSet__EMPTY){
+                new (slots + i) ElementType(s.slots[i]);
+                control[i] = s.control[i];
+            }
+        }
+    }
+    catch(...){
+        release();
+        throw;
+    }
+
+    sz = s.sz;
+}
+
+
+template <typename ElementType>
+FlatHashSet<ElementType>::FlatHashSet(FlatHashSet&& s) noexcept
+    : control{nullptr}, slots{nullptr}, groups{0}, sz{0}, hashFunction{}
+{
+    swap(s);
+}
+
+
+template <typename ElementType>
+FlatHashSet<ElementType>& FlatHashSet<ElementType>::operator=(const FlatHashSet& s)
+{
+    if(this != &s){
+        FlatHashSet copy{s};
+        swap(copy);
+    }
+    return *this;
+}
+
+
+template <typename ElementType>
+FlatHashSet<ElementType>& FlatHashSet<ElementType>::operator=(FlatHashSet&& s) noexcept
+{
+    swap(s);
+    return *this;
+}
+
+
+template <typename ElementType>
+bool FlatHashSet<ElementType>::isImplemented() const noexcept
+{
+    return true;
+}
+
+
+template <typename ElementType>
+void FlatHashSet<ElementType>::add(const ElementType& element)
+{
+    std::uint64_t mixed = mix(element);
+    Probe p = probe(element, mixed);
+    if(p.found){
+        return;
+    }
+
+    unsigned int capacity = groups * GROUP_WIDTH;
+    if(sz + 1 > capacity - capacity / 8){
+        grow();
+        p.slot = findEmptySlot(mixed);
+    }
+
+    new (slots + p.slot) ElementType(element);
+    control[p.slot] = static_cast<signed char>((mixed >> 25) & 0x7F);
+    sz++;
+}
+
+
+template <typename ElementType>
+bool FlatHashSet<ElementType>::contains(const ElementType& element) const
+{
+    return groups != 0 && probe(element, mix(element)).found;
+}
+
+
+template <typename ElementType>
+unsigned int FlatHashSet<ElementType>::size() const noexcept
+{
+    return sz;
+}
+
+
+template <typename ElementType>
+unsigned int FlatHashSet<ElementType>::groupCount() const noexcept
+{
+    return groups;
+}
+
+
+template <typename ElementType>
+unsigned int FlatHashSet<ElementType>::elementsInGroup(unsigned int group) const
+{
+    if(group >= groups){
+        return 0;
+    }
+    unsigned int empty = impl_::FlatHashSet__matchEmpty(control + group * GROUP_WIDTH);
+    unsigned int count = GROUP_WIDTH;
+    while(empty != 0){
+        empty &= empty - 1;
+        count--;
+    }
+    return count;
+}
+
+
+template <typename ElementType>
+unsigned int FlatHashSet<ElementType>::groupsProbed(const ElementType& element) const
+{
+    return groups == 0 ? 0 : probe(element, mix(element)).groupsProbed;
+}
+
+
+template <typename ElementType>
+std::uint64_t FlatHashSet<ElementType>::mix(const ElementType& element) const
+{
+    //Multiplying by an odd constant spreads every bit of the hash into the
+    //upper half, which chooses the group, and into bits 25 to 31, which
+    //are the control byte.
+    return static_cast<std::uint64_t>(hashFunction(element)) * 0x9E3779B97F4A7C15ull;
+}
+
+
+template <typename ElementType>
+typename FlatHashSet<ElementType>::Probe FlatHashSet<ElementType>::probe(
+    const ElementType& element, std::uint64_t mixed) const
+{
+    signed char h2 = static_cast<signed char>((mixed >> 25) & 0x7F);
+    unsigned int mask = groups - 1;
+    unsigned int group = static_cast<unsigned int>(mixed >> 32) & mask;
+
+    for(unsigned int step = 1; ; step++){
+        const signed char* groupControl = control + group * GROUP_WIDTH;
+
+        for(unsigned int matches = impl_::FlatHashSet__match(groupControl, h2); matches != 0; matches &= matches - 1){
+            unsigned int slot = group * GROUP_WIDTH + impl_::FlatHashSet__lowestBit(matches);
+            if(slots[slot] == element){
+                return Probe{slot, true, step};
+            }
+        }
+
+        unsigned int empty = impl_::FlatHashSet__matchEmpty(groupControl);
+        if(empty != 0){
+            return Probe{group * GROUP_WIDTH + impl_::FlatHashSet__lowestBit(empty), false, step};
+        }
+
+        //Adding 1, 2, 3, ... visits every group when there's a power of
+        //two of them.
+        group = (group + step) & mask;
+    }
+}
+
+
+template <typename ElementType>
+unsigned int FlatHashSet<ElementType>::findEmptySlot(std::uint64_t mixed) const noexcept
+{
+    unsigned int mask = groups - 1;
+    unsigned int group = static_cast<unsigned int>(mixed >> 32) & mask;
+
+    for(unsigned int step = 1; ; step++){
+        unsigned int empty = impl_::FlatHashSet__matchEmpty(control + group * GROUP_WIDTH);
+        if(empty != 0){
+            return group * GROUP_WIDTH + impl_::FlatHashSet__lowestBit(empty);
+        }
+        group = (group + step) & mask;
+    }
+}
+
+
+template <typename ElementType>
+void FlatHashSet<ElementType>::allocate(unsigned int newGroups)
+{
+    unsigned int capacity = newGroups * GROUP_WIDTH;
+    ElementType* newSlots = std::allocator<ElementType>{}.allocate(capacity);
+    signed char* newControl;
+    try{
+        newControl = new signed char[capacity];
+    }
+    catch(...){
+        std::allocator<ElementType>{}.deallocate(newSlots, capacity);
+        throw;
+    }
+    for(unsigned int i = 0; i < capacity; i++){
+        newControl[i] = impl_::FlatHashSet__EMPTY;
+    }
+    control = newControl;
+    slots = newSlots;
+    groups = newGroups;
+}
+
+
+template <typename ElementType>
+void FlatHashSet<ElementType>::release() noexcept
+{
+    if(slots == nullptr){
+        return;
+    }
+    unsigned int capacity = groups * GROUP_WIDTH;
+    for(unsigned int i = 0; i < capacity; i++){
+        if(control[i] != impl_::FlatHashSet__EMPTY){
+            slots[i].~ElementType();
+        }
+    }
+    std::allocator<ElementType>{}.deallocate(slots, capacity);
+    delete[] control;
+    slots = nullptr;
+    control = nullptr;
+    groups = 0;
+    sz = 0;
+}
+
+
+template <typename ElementType>
+void FlatHashSet<ElementType>::grow()
+{
+    signed char* oldControl = control;
+    ElementType* oldSlots = slots;
+    unsigned int oldCapacity = groups * GROUP_WIDTH;
+
+    allocate(groups * 2);
+
+    //The elements are already distinct, so each one only needs an empty
+    //slot; none of them is compared with anything.
+    for(unsigned int i = 0; i < oldCapacity; i++){
+        if(oldControl[i] != impl_::FlatHashSet__EMPTY){
+            unsigned int slot = findEmptySlot(mix(oldSlots[i]));
+            new (slots + slot) ElementType(std::move(oldSlots[i]));
+            control[slot] = oldControl[i];
+            oldSlots[i].~ElementType();
+        }
+    }
+
+    std::allocator<ElementType>{}.deallocate(oldSlots, oldCapacity);
+    delete[] oldControl;
+}
+
+
+template <typename ElementType>
+void FlatHashSet<ElementType>::swap(FlatHashSet& s) noexcept
+{
+    std::swap(control, s.control);
+    std::swap(slots, s.slots);
+    std::swap(groups, s.groups);
+    std::swap(sz, s.sz);
+    std::swap(hashFunction, s.hashFunction);
+}
+
+
+
+#endif
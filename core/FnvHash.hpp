@@ -0,0 +1,38 @@
+// FnvHash.hpp
+//
+// FnvHash is the 32-bit FNV-1a hash of a string's bytes, as a function
+// object type.  Given to a HashSet as its Hasher, e.g.,
+//
+//     HashSet<std::string, FnvHash> words{FnvHash{}};
+//
+// it's called directly rather than through a std::function, so it can be
+// inlined into every lookup.  It's transparent: it hashes a
+// std::string_view the same way as a std::string with the same bytes, so
+// that set's contains() can look up a view without copying it.
+
+#ifndef FNVHASH_HPP
+#define FNVHASH_HPP
+
+#include <string_view>
+
+
+
+struct FnvHash
+{
+    using is_transparent = void;
+
+    unsigned int operator()(std::string_view s) const noexcept
+    {
+        unsigned int hash = 2166136261u;
+
+        for(char c : s){
+            hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+        }
+
+        return hash;
+    }
+};
+
+
+
+#endif
@@ -24,11 +24,38 @@
 #define HASHSET_HPP
 
 #include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include "Set.hpp"
 
 
 
-template <typename ElementType>
+namespace impl_
+{
+    // A HashSet of strings can look up a View (a std::string_view, or
+    // anything that converts to one) without building a std::string from
+    // it, as long as its Hasher declares is_transparent, promising that it
+    // hashes a view the same way as the string it views.
+    template <typename ElementType, typename Hasher, typename View, typename = void>
+    struct HashSet__looksUpViews : std::false_type
+    {
+    };
+
+
+    template <typename ElementType, typename Hasher, typename View>
+    struct HashSet__looksUpViews<ElementType, Hasher, View, std::void_t<typename Hasher::is_transparent>>
+        : std::bool_constant<std::is_same_v<ElementType, std::string>
+            && !std::is_same_v<View, std::string>
+            && std::is_convertible_v<const View&, std::string_view>>
+    {
+    };
+}
+
+
+
+template <typename ElementType, typename Hasher = std::function<unsigned int(const ElementType&)>>
 class HashSet : public Set<ElementType>
 {
 public:
@@ -37,8 +64,11 @@ public:
     static constexpr unsigned int DEFAULT_CAPACITY = 10;
 
     // A HashFunction is a function that takes a reference to a const
-    // ElementType and returns an unsigned int.
-    using HashFunction = std::function<unsigned int(const ElementType&)>;
+    // ElementType and returns an unsigned int.  By default it's a
+    // std::function, which can hold any such function but is an indirect
+    // call on every lookup; a function object type given as the Hasher is
+    // called directly, and can be inlined.
+    using HashFunction = Hasher;
 
 public:
     // Initializes a HashSet to be empty, so that it will use the given
@@ -51,8 +81,13 @@ public:
     // Initializes a new HashSet to be a copy of an existing one.
     HashSet(const HashSet& s);
 
-    // Initializes a new HashSet whose contents are moved from an
-    // expiring one.
+    // Initializes a new HashSet whose contents and hash function are moved
+    // from an expiring one, without allocating anything.  The expiring one
+    // is left empty, with no array and a moved-from hash function.  It can
+    // be destroyed, copied, assigned to or searched (finding nothing), but
+    // the next add() allocates an array and hashes with what's left of the
+    // hash function, so a std::function must be given a new one (by
+    // assigning the HashSet) first.
     HashSet(HashSet&& s) noexcept;
 
     // Assigns an existing HashSet into another.
@@ -74,10 +109,15 @@ public:
     //
     //     capacity * 2 + 1
     //
-    // In the case where the array is resized, this function runs in linear
-    // time (with respect to the number of elements, assuming a good hash
-    // function); otherwise, it runs in constant time (again, assuming a good
-    // hash function).  The amortized running time is also constant.
+    // The elements aren't all moved to the new array at once.  Instead,
+    // each add() relinks the nodes in the next few buckets of the old one
+    // into it, without copying any elements, and lookups check both arrays
+    // until the old one is empty.  The number of buckets is spread evenly
+    // over the adds left before the new array is 80% full (about two per
+    // add), so the old array is always empty by the time it's needed
+    // again.  So the add() that resizes the array only allocates and
+    // clears the new one, and every add() runs in constant time (assuming
+    // a good hash function) apart from that.
     void add(const ElementType& element) override;
 
 
@@ -87,13 +127,24 @@ public:
     bool contains(const ElementType& element) const override;
 
 
+    // In a HashSet<std::string> whose Hasher is transparent (such as
+    // FnvHash), contains() also takes a std::string_view, or anything else
+    // that converts to one, and looks it up without copying it into a
+    // std::string first.
+    template <typename View,
+              typename = std::enable_if_t<impl_::HashSet__looksUpViews<ElementType, Hasher, View>::value>>
+    bool contains(const View& element) const;
+
+
     // size() returns the number of elements in the set.
     unsigned int size() const noexcept override;
 
 
     // elementsAtIndex() returns the number of elements that hashed to a
     // particular index in the array.  If the index is out of the boundaries
-    // of the array, this function returns 0.
+    // of the array, this function returns 0.  Elements still in the old
+    // array count at the index they're moving to, so while the HashSet is
+    // growing, this function also scans the old array's remaining buckets.
     unsigned int elementsAtIndex(unsigned int index) const;
 
 
@@ -109,10 +160,28 @@ private:
         Node* next;
     };
     void rehash();
+    void migrate(unsigned int buckets);
+    unsigned int bucketsToMigrate() const noexcept;
+    template <typename Key>
+    bool containsHashed(const Key& element, unsigned int hash) const;
+    void deleteOldTable() noexcept;
+    void appendUnmigrated(const HashSet& s);
+    static void appendToChain(Node*& chain, Node* node);
+    template <typename Key>
+    static bool chainContains(const Node* chain, const Key& element);
+    template <typename Key>
+    bool inOldTable(const Key& element, unsigned int hash) const;
     Node** hashTable;
     HashFunction hashFunction;
-    int sz;
-    int capacity;
+    unsigned int sz;
+    unsigned int capacity;
+
+    // While the HashSet is growing, oldTable is the array it had before,
+    // whose buckets from migrated on haven't been moved into hashTable
+    // yet.  Otherwise, oldTable is nullptr.
+    Node** oldTable;
+    unsigned int oldCapacity;
+    unsigned int migrated;
     
 
     // You'll no doubt want to add member variables and "helper" member
@@ -131,20 +200,21 @@ namespace impl_
 }
 
 
-template <typename ElementType>
-HashSet<ElementType>::HashSet(HashFunction hashFunction)
-    : hashTable{new Node*[DEFAULT_CAPACITY]}, hashFunction{hashFunction}, sz{0}, capacity{DEFAULT_CAPACITY}
+template <typename ElementType, typename Hasher>
+HashSet<ElementType, Hasher>::HashSet(HashFunction hashFunction)
+    : hashTable{new Node*[DEFAULT_CAPACITY]}, hashFunction{hashFunction}, sz{0}, capacity{DEFAULT_CAPACITY},
+      oldTable{nullptr}, oldCapacity{0}, migrated{0}
 {
-    for(int j = 0;j<DEFAULT_CAPACITY;j++){
+    for(unsigned int j = 0;j<DEFAULT_CAPACITY;j++){
         hashTable[j] = nullptr;
     }
 }
 
 
-template <typename ElementType>
-HashSet<ElementType>::~HashSet() noexcept
+template <typename ElementType, typename Hasher>
+HashSet<ElementType, Hasher>::~HashSet() noexcept
 {
-    for(int i =0; i<capacity; i++){
+    for(unsigned int i =0; i<capacity; i++){
         Node* current = hashTable[i];
         while(current != nullptr){
             Node* tempNode = current;
@@ -153,20 +223,21 @@ HashSet<ElementType>::~HashSet() noexcept
         }
     }
     delete []hashTable;
+    deleteOldTable();
 }
 
 
-template <typename ElementType>
-HashSet<ElementType>::HashSet(const HashSet& s)
+template <typename ElementType, typename Hasher>
+HashSet<ElementType, Hasher>::HashSet(const HashSet& s)
     //: hashTable{new Node*[s.capacity]},hashFunction{impl_::HashSet__undefinedHashFunction<ElementType>}, sz{s.sz}, capacity{s.capacity}
 {
     Node**tempTable;
     try{
         tempTable = new Node*[s.capacity];
-        for(int k = 0; k<s.capacity;k++){
+        for(unsigned int k = 0; k<s.capacity;k++){
             tempTable[k] = nullptr;
         }
-        for(int m=0; m<s.capacity;m++){
+        for(unsigned int m=0; m<s.capacity;m++){
             Node * tempCurrent = s.hashTable[m];
             while(tempCurrent != nullptr){
                 Node * pNode = new Node();
@@ -184,7 +255,7 @@ HashSet<ElementType>::HashSet(const HashSet& s)
                 tempCurrent = tempCurrent->next;
             }
         }
-        for(int i =0; i<s.capacity; i++){
+        for(unsigned int i =0; i<s.capacity; i++){
             Node* current = tempTable[i];
             while(current != nullptr){
                 Node* tempNode = current;
@@ -202,10 +273,13 @@ HashSet<ElementType>::HashSet(const HashSet& s)
     hashFunction = s.hashFunction;
     sz = s.sz;
     capacity = s.capacity;
-    for(int j = 0;j<s.capacity;j++){
+    oldTable = nullptr;
+    oldCapacity = 0;
+    migrated = 0;
+    for(unsigned int j = 0;j<s.capacity;j++){
         hashTable[j] = nullptr;
     }
-    for (int i=0; i<s.capacity;i++){
+    for (unsigned int i=0; i<s.capacity;i++){
         Node * current = s.hashTable[i];
         while(current != nullptr){
             Node * pNode = new Node();
@@ -223,44 +297,36 @@ HashSet<ElementType>::HashSet(const HashSet& s)
             current = current->next;
         }
     }
+    appendUnmigrated(s);
 }
 
 
-template <typename ElementType>
-HashSet<ElementType>::HashSet(HashSet&& s) noexcept
-    : hashTable{new Node*[DEFAULT_CAPACITY]}, hashFunction{impl_::HashSet__undefinedHashFunction<ElementType>}, sz{0}, capacity{DEFAULT_CAPACITY}
+template <typename ElementType, typename Hasher>
+HashSet<ElementType, Hasher>::HashSet(HashSet&& s) noexcept
+    : hashTable{nullptr}, hashFunction{std::move(s.hashFunction)}, sz{0}, capacity{0},
+      oldTable{nullptr}, oldCapacity{0}, migrated{0}
 {
-    for(int j = 0;j<DEFAULT_CAPACITY;j++){
-        hashTable[j] = nullptr;
-    }
-    Node** tempTable = s.hashTable;
-    std::function tempFunction = s.hashFunction;
-    int tempSz = s.sz;
-    int tempCapacity = s.capacity;
-
-    s.hashTable = hashTable;
-    s.hashFunction = hashFunction;
-    s.sz = sz;
-    s.capacity = capacity;
-
-    hashTable = tempTable;
-    hashFunction = tempFunction;
-    sz = tempSz;
-    capacity = tempCapacity;
+    std::swap(hashTable, s.hashTable);
+    std::swap(sz, s.sz);
+    std::swap(capacity, s.capacity);
+
+    std::swap(oldTable, s.oldTable);
+    std::swap(oldCapacity, s.oldCapacity);
+    std::swap(migrated, s.migrated);
 }
 
 
-template <typename ElementType>
-HashSet<ElementType>& HashSet<ElementType>::operator=(const HashSet& s)
+template <typename ElementType, typename Hasher>
+HashSet<ElementType, Hasher>& HashSet<ElementType, Hasher>::operator=(const HashSet& s)
 {
     if (this != &s){
         Node**tempTable;
         try{
             tempTable = new Node*[s.capacity];
-            for(int k = 0; k<s.capacity;k++){
+            for(unsigned int k = 0; k<s.capacity;k++){
                 tempTable[k] = nullptr;
             }
-            for(int m=0; m<s.capacity;m++){
+            for(unsigned int m=0; m<s.capacity;m++){
                 Node * tempCurrent = s.hashTable[m];
                 while(tempCurrent != nullptr){
                     Node * pNode = new Node();
@@ -279,7 +345,7 @@ HashSet<ElementType>& HashSet<ElementType>::operator=(const HashSet& s)
                 }
             }
             
-            for(int i =0; i<capacity; i++){
+            for(unsigned int i =0; i<s.capacity; i++){
                 Node* current = tempTable[i];
                 while(current != nullptr){
                     Node* tempNode = current;
@@ -293,7 +359,7 @@ HashSet<ElementType>& HashSet<ElementType>::operator=(const HashSet& s)
             throw;
         }
         //delete the original hashTable
-        for(int q =0; q<capacity; q++){
+        for(unsigned int q =0; q<capacity; q++){
             Node* current = hashTable[q];
             while(current != nullptr){
                 Node* tempNode = current;
@@ -302,18 +368,19 @@ HashSet<ElementType>& HashSet<ElementType>::operator=(const HashSet& s)
             }
         }
         delete []hashTable;
+        deleteOldTable();
 
         //Initialize this hash set again
         hashTable = new Node*[s.capacity];
         sz = s.sz;
         this->hashFunction = s.hashFunction;
         capacity = s.capacity;
-        for(int a1=0; a1<s.capacity;a1++){
+        for(unsigned int a1=0; a1<s.capacity;a1++){
             hashTable[a1] = nullptr;
         }
 
         //Assign the value to our new hashTable
-        for (int i=0; i<capacity;i++){
+        for (unsigned int i=0; i<capacity;i++){
             Node * current = s.hashTable[i];
             while(current != nullptr){
                 Node * pNode = new Node();
@@ -331,88 +398,186 @@ HashSet<ElementType>& HashSet<ElementType>::operator=(const HashSet& s)
                 current = current->next;
             }
         }
+        appendUnmigrated(s);
     }
     return *this;
 }
 
 
-template <typename ElementType>
-HashSet<ElementType>& HashSet<ElementType>::operator=(HashSet&& s) noexcept
+template <typename ElementType, typename Hasher>
+HashSet<ElementType, Hasher>& HashSet<ElementType, Hasher>::operator=(HashSet&& s) noexcept
 {
-    Node** tempTable = s.hashTable;
-    std::function tempFunction = s.hashFunction;
-    int tempSz = s.sz;
-    int tempCapacity = s.capacity;
-
-    s.hashTable = hashTable;
-    s.hashFunction = hashFunction;
-    s.sz = sz;
-    s.capacity = capacity;
-
-    hashTable = tempTable;
-    hashFunction = tempFunction;
-    sz = tempSz;
-    capacity = tempCapacity;
+    std::swap(hashTable, s.hashTable);
+    std::swap(hashFunction, s.hashFunction);
+    std::swap(sz, s.sz);
+    std::swap(capacity, s.capacity);
+
+    std::swap(oldTable, s.oldTable);
+    std::swap(oldCapacity, s.oldCapacity);
+    std::swap(migrated, s.migrated);
     return *this;
 }
 
 
-template <typename ElementType>
-bool HashSet<ElementType>::isImplemented() const noexcept
+template <typename ElementType, typename Hasher>
+bool HashSet<ElementType, Hasher>::isImplemented() const noexcept
 {
     return true;
 }
 
-template <typename ElementType>
-void HashSet<ElementType>::rehash(){
-    //rehash() reconstruct a new array of pointers that doubled the capacity of the previous one and rehash all the values within it to the new array.
+template <typename ElementType, typename Hasher>
+void HashSet<ElementType, Hasher>::rehash(){
+    //rehash() replaces the array of pointers with a new, empty one that
+    //doubled the capacity of the previous one.  The previous one becomes
+    //the old table, whose values migrate() moves into the new one a few
+    //buckets at a time.
+    //bucketsToMigrate() paces the migration so the add() that calls this
+    //has already moved the last of the old table; this only makes sure.
+    migrate(oldCapacity - migrated);
     Node** nodeList = new Node*[capacity*2+1];
-    for(int j = 0;j<capacity*2+1;j++){
+    for(unsigned int j = 0;j<capacity*2+1;j++){
         nodeList[j] = nullptr;
     }
-    for(int i=0; i< capacity;i++){
-        Node*current = hashTable[i];
-        while(current != nullptr){
-            int index = hashFunction(current->value)%(capacity*2+1);
-            if(nodeList[index] == nullptr){
-                nodeList[index] = new Node();
-                nodeList[index]->value = current->value;
-                nodeList[index]->next =nullptr;
-            }
-            else{
-                Node* contemporaryNode = nodeList[index];
-                while(contemporaryNode->next != nullptr){
-                    contemporaryNode = contemporaryNode->next;
-                }
-                contemporaryNode->next = new Node();
-                contemporaryNode->next->value = current->value;
-                contemporaryNode->next->next = nullptr;
-            }
-            current = current->next;
+    oldTable = hashTable;
+    oldCapacity = capacity;
+    migrated = 0;
+    hashTable = nodeList;
+    capacity = capacity*2+1;
+}
+
 
+template <typename ElementType, typename Hasher>
+void HashSet<ElementType, Hasher>::migrate(unsigned int buckets){
+    //migrate() relinks the nodes in the old table's next few buckets into
+    //the new array, without allocating, copying or deleting any of them,
+    //and deletes the old table once every bucket has been moved.  Each
+    //node goes on the front of its new chain, so the chain doesn't have to
+    //be walked.
+    if(oldTable == nullptr){
+        return;
+    }
+    unsigned int end = buckets < oldCapacity - migrated ? migrated + buckets : oldCapacity;
+    for(; migrated < end; migrated++){
+        Node* current = oldTable[migrated];
+        while(current != nullptr){
+            Node* next = current->next;
+            unsigned int index = hashFunction(current->value)%capacity;
+            current->next = hashTable[index];
+            hashTable[index] = current;
+            current = next;
         }
+        oldTable[migrated] = nullptr;
+    }
+    if(migrated == oldCapacity){
+        deleteOldTable();
     }
+}
+
+
+template <typename ElementType, typename Hasher>
+unsigned int HashSet<ElementType, Hasher>::bucketsToMigrate() const noexcept{
+    //The buckets left are spread evenly over the adds left before the
+    //array reaches the 0.8 load factor again, counting the one in
+    //progress, so the last of them is moved by the add that gets there.
+    if(oldTable == nullptr){
+        return 0;
+    }
+    unsigned int full = (capacity*4 + 4)/5;
+    unsigned int addsLeft = full > sz ? full - sz : 1;
+    return (oldCapacity - migrated + addsLeft - 1)/addsLeft;
+}
 
-    for(int k =0; k< capacity; k++){
-        Node* now = hashTable[k];
+
+template <typename ElementType, typename Hasher>
+void HashSet<ElementType, Hasher>::deleteOldTable() noexcept{
+    if(oldTable == nullptr){
+        return;
+    }
+    for(unsigned int k = migrated; k < oldCapacity; k++){
+        Node* now = oldTable[k];
         while(now != nullptr){
             Node* temp = now;
             now = now->next;
             delete temp;
         }
     }
-    delete [] hashTable;
-    hashTable = nodeList;
-    capacity = capacity*2+1;
-    
+    delete [] oldTable;
+    oldTable = nullptr;
+    oldCapacity = 0;
+    migrated = 0;
+}
+
+
+template <typename ElementType, typename Hasher>
+void HashSet<ElementType, Hasher>::appendUnmigrated(const HashSet& s){
+    //The values s hadn't moved out of its old table yet are copied
+    //straight into this set's array, so a copy never starts out growing.
+    if(s.oldTable == nullptr){
+        return;
+    }
+    for(unsigned int i = s.migrated; i < s.oldCapacity; i++){
+        for(const Node* current = s.oldTable[i]; current != nullptr; current = current->next){
+            unsigned int index = hashFunction(current->value)%capacity;
+            appendToChain(hashTable[index], new Node{current->value, nullptr});
+        }
+    }
 }
 
-template <typename ElementType>
-void HashSet<ElementType>::add(const ElementType& element)
+
+template <typename ElementType, typename Hasher>
+void HashSet<ElementType, Hasher>::appendToChain(Node*& chain, Node* node){
+    if(chain == nullptr){
+        chain = node;
+        return;
+    }
+    Node* current = chain;
+    while(current->next != nullptr){
+        current = current->next;
+    }
+    current->next = node;
+}
+
+
+template <typename ElementType, typename Hasher>
+template <typename Key>
+bool HashSet<ElementType, Hasher>::chainContains(const Node* chain, const Key& element){
+    for(const Node* current = chain; current != nullptr; current = current->next){
+        if(current->value == element){
+            return true;
+        }
+    }
+    return false;
+}
+
+
+template <typename ElementType, typename Hasher>
+template <typename Key>
+bool HashSet<ElementType, Hasher>::inOldTable(const Key& element, unsigned int hash) const{
+    //An element is only still in the old table if its bucket there
+    //hasn't been moved yet.
+    if(oldTable == nullptr){
+        return false;
+    }
+    unsigned int oldIndex = hash%oldCapacity;
+    return oldIndex >= migrated && chainContains(oldTable[oldIndex], element);
+}
+
+template <typename ElementType, typename Hasher>
+void HashSet<ElementType, Hasher>::add(const ElementType& element)
 {
     
-    if(!contains(element)){
-        int index = hashFunction(element)%capacity;
+    unsigned int hash = hashFunction(element);
+    if(!containsHashed(element, hash)){
+        //A moved-from HashSet has no array until something is added to it.
+        if(capacity == 0){
+            hashTable = new Node*[DEFAULT_CAPACITY];
+            for(unsigned int j = 0;j<DEFAULT_CAPACITY;j++){
+                hashTable[j] = nullptr;
+            }
+            capacity = DEFAULT_CAPACITY;
+        }
+        migrate(bucketsToMigrate());
+        unsigned int index = hash%capacity;
         Node* pNode = new Node();
         pNode->value = element;
         pNode->next = nullptr;
@@ -439,52 +604,65 @@ void HashSet<ElementType>::add(const ElementType& element)
 }
 
 
-template <typename ElementType>
-bool HashSet<ElementType>::contains(const ElementType& element) const
+template <typename ElementType, typename Hasher>
+bool HashSet<ElementType, Hasher>::contains(const ElementType& element) const
 {
-    
-    int currentIndex = hashFunction(element)%capacity;
-    if(hashTable[currentIndex] == nullptr){
-        return false;
-    }
-    Node*current = hashTable[currentIndex];
-    while(current != nullptr){
-        if(current->value == element){
-            return true;
-        }
-        current = current->next;
-    }
-    
-    return false;
-    
+    return capacity != 0 && containsHashed(element, hashFunction(element));
 }
 
 
-template <typename ElementType>
-unsigned int HashSet<ElementType>::size() const noexcept
+template <typename ElementType, typename Hasher>
+template <typename View, typename>
+bool HashSet<ElementType, Hasher>::contains(const View& element) const
+{
+    std::string_view view = element;
+    return capacity != 0 && containsHashed(view, hashFunction(view));
+}
+
+
+template <typename ElementType, typename Hasher>
+template <typename Key>
+bool HashSet<ElementType, Hasher>::containsHashed(const Key& element, unsigned int hash) const
+{
+    return (capacity != 0 && chainContains(hashTable[hash%capacity], element)) || inOldTable(element, hash);
+}
+
+
+template <typename ElementType, typename Hasher>
+unsigned int HashSet<ElementType, Hasher>::size() const noexcept
 {
     return sz;
 }
 
 
-template <typename ElementType>
-unsigned int HashSet<ElementType>::elementsAtIndex(unsigned int index) const
+template <typename ElementType, typename Hasher>
+unsigned int HashSet<ElementType, Hasher>::elementsAtIndex(unsigned int index) const
 {
     if(index >= capacity){
         return 0;
     }
-    int count = 0;
+    unsigned int count = 0;
     Node* current = hashTable[index];
     while(current != nullptr){
         count++;
         current = current->next;
     }
+    //Values still in the old table count toward the index they'll be
+    //moved to, and could be in any of its unmoved buckets, so every one of
+    //them is rehashed.
+    for(unsigned int i = migrated; oldTable != nullptr && i < oldCapacity; i++){
+        for(const Node* old = oldTable[i]; old != nullptr; old = old->next){
+            if(hashFunction(old->value)%capacity == index){
+                count++;
+            }
+        }
+    }
     return count;
 }
 
 
-template <typename ElementType>
-bool HashSet<ElementType>::isElementAtIndex(const ElementType& element, unsigned int index) const
+template <typename ElementType, typename Hasher>
+bool HashSet<ElementType, Hasher>::isElementAtIndex(const ElementType& element, unsigned int index) const
 {
     if(index>=capacity){
         return false;
@@ -496,7 +674,10 @@ bool HashSet<ElementType>::isElementAtIndex(const ElementType& element, unsigned
         }
         current = current->next;
     }
-    
+    if(oldTable != nullptr){
+        unsigned int hash = hashFunction(element);
+        return hash%capacity == index && inOldTable(element, hash);
+    }
     return false;
 }
 
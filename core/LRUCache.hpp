@@ -0,0 +1,153 @@
+// LRUCache.hpp
+//
+// An LRUCache is a bounded, thread-safe map from keys to values that, once
+// it holds as many entries as its capacity allows, makes room for a new one
+// by evicting the entry that was least recently used.
+//
+// Entries are kept in a doubly-linked list in order of use, most recent
+// first, alongside a hash table that finds each key's place in the list, so
+// lookups, insertions and evictions all run in constant time.  A single
+// mutex guards both, so one LRUCache can be shared by several threads.
+//
+// The cache also counts its hits, misses and evictions, so its capacity can
+// be tuned against real traffic.
+
+#ifndef LRUCACHE_HPP
+#define LRUCACHE_HPP
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+
+
+struct LRUCacheStats
+{
+    unsigned long long hits;
+    unsigned long long misses;
+    unsigned long long evictions;
+    unsigned int size;
+    unsigned int capacity;
+};
+
+
+
+template <typename KeyType, typename ValueType>
+class LRUCache
+{
+public:
+    // Initializes an empty LRUCache that holds at most capacity entries.
+    // A capacity of 0 makes a cache that never holds anything.
+    explicit LRUCache(unsigned int capacity);
+
+
+    // get() looks up the given key.  If it's in the cache, its value is
+    // copied into value, the entry becomes the most recently used one, and
+    // get() returns true; otherwise, get() returns false.
+    bool get(const KeyType& key, ValueType& value);
+
+
+    // put() stores a value for the given key, replacing any value already
+    // stored for it, and makes it the most recently used entry.  If the
+    // cache was full, the least recently used entry is evicted.
+    void put(const KeyType& key, const ValueType& value);
+
+
+    // clear() removes every entry from the cache, but leaves the counts
+    // of hits, misses and evictions alone.
+    void clear();
+
+
+    // stats() returns the cache's counts, size and capacity.
+    LRUCacheStats stats() const;
+
+
+private:
+    using Entry = std::pair<KeyType, ValueType>;
+
+    mutable std::mutex mutex;
+    std::list<Entry> entries;
+    std::unordered_map<KeyType, typename std::list<Entry>::iterator> positions;
+    unsigned int capacity;
+    unsigned long long hits;
+    unsigned long long misses;
+    unsigned long long evictions;
+};
+
+
+
+template <typename KeyType, typename ValueType>
+LRUCache<KeyType, ValueType>::LRUCache(unsigned int capacity)
+    : capacity{capacity}, hits{0}, misses{0}, evictions{0}
+{
+}
+
+
+template <typename KeyType, typename ValueType>
+bool LRUCache<KeyType, ValueType>::get(const KeyType& key, ValueType& value)
+{
+    std::lock_guard<std::mutex> lock{mutex};
+
+    auto found = positions.find(key);
+    if(found == positions.end()){
+        misses++;
+        return false;
+    }
+
+    hits++;
+    entries.splice(entries.begin(), entries, found->second);
+    value = found->second->second;
+    return true;
+}
+
+
+template <typename KeyType, typename ValueType>
+void LRUCache<KeyType, ValueType>::put(const KeyType& key, const ValueType& value)
+{
+    std::lock_guard<std::mutex> lock{mutex};
+
+    if(capacity == 0){
+        return;
+    }
+
+    auto found = positions.find(key);
+    if(found != positions.end()){
+        found->second->second = value;
+        entries.splice(entries.begin(), entries, found->second);
+        return;
+    }
+
+    if(entries.size() >= capacity){
+        positions.erase(entries.back().first);
+        entries.pop_back();
+        evictions++;
+    }
+
+    entries.emplace_front(key, value);
+    positions.emplace(key, entries.begin());
+}
+
+
+template <typename KeyType, typename ValueType>
+void LRUCache<KeyType, ValueType>::clear()
+{
+    std::lock_guard<std::mutex> lock{mutex};
+
+    entries.clear();
+    positions.clear();
+}
+
+
+template <typename KeyType, typename ValueType>
+LRUCacheStats LRUCache<KeyType, ValueType>::stats() const
+{
+    std::lock_guard<std::mutex> lock{mutex};
+
+    return LRUCacheStats{hits, misses, evictions,
+        static_cast<unsigned int>(entries.size()), capacity};
+}
+
+
+
+#endif
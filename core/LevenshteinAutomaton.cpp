@@ -0,0 +1,171 @@
+// LevenshteinAutomaton.cpp
+
+#include "LevenshteinAutomaton.hpp"
+#include <algorithm>
+
+
+
+LevenshteinAutomaton::LevenshteinAutomaton(const std::string& word, unsigned int maxDistance)
+    : word{word}, maxDistance{maxDistance}
+{
+}
+
+
+LevenshteinAutomaton::State LevenshteinAutomaton::start() const
+{
+    State state(word.size() + 1);
+    for(std::size_t j = 0; j <= word.size(); j++){
+        state[j] = std::min<unsigned int>(j, maxDistance + 1);
+    }
+    return state;
+}
+
+
+LevenshteinAutomaton::State LevenshteinAutomaton::step(const State& state, char c) const
+{
+    State next(word.size() + 1);
+    step(state.data(), c, next.data());
+    return next;
+}
+
+
+bool LevenshteinAutomaton::isMatch(const State& state) const noexcept
+{
+    return state.back() <= maxDistance;
+}
+
+
+bool LevenshteinAutomaton::canMatch(const State& state) const noexcept
+{
+    return canMatch(state.data());
+}
+
+
+std::vector<std::string> LevenshteinAutomaton::intersect(const TrieSet& trie) const
+{
+    // The rows for the whole current path through the trie live in one
+    // buffer, one row per depth, so walking it allocates nothing per node.
+    std::vector<unsigned int> rows;
+    State first = start();
+    rows.insert(rows.end(), first.begin(), first.end());
+
+    std::vector<std::string> result;
+    std::string prefix;
+
+    if(trie.root().isWord() && isMatch(first)){
+        result.push_back(prefix);
+    }
+    intersect(trie, trie.root(), prefix, rows, result);
+
+    return result;
+}
+
+
+std::vector<std::string> LevenshteinAutomaton::intersect(const std::vector<std::string>& sortedWords) const
+{
+    // Consecutive sorted words usually share a prefix, whose rows are kept
+    // from the previous word; only the rows past the shared prefix are
+    // recomputed.  rows holds one row per character of the current word.
+    std::size_t width = word.size() + 1;
+    std::vector<unsigned int> rows;
+    State first = start();
+    rows.insert(rows.end(), first.begin(), first.end());
+
+    std::vector<std::string> result;
+    const std::string* previous = nullptr;
+    std::size_t i = 0;
+
+    while(i < sortedWords.size()){
+        const std::string& candidate = sortedWords[i];
+
+        std::size_t shared = 0;
+        if(previous != nullptr){
+            std::size_t limit = std::min(previous->size(), candidate.size());
+            while(shared < limit && (*previous)[shared] == candidate[shared]){
+                shared++;
+            }
+        }
+
+        rows.resize((candidate.size() + 1) * width);
+
+        std::size_t depth = shared;
+        while(depth < candidate.size() && canMatch(&rows[depth * width])){
+            step(&rows[depth * width], candidate[depth], &rows[(depth + 1) * width]);
+            depth++;
+        }
+
+        if(depth == candidate.size()){
+            if(rows[depth * width + word.size()] <= maxDistance){
+                result.push_back(candidate);
+            }
+            previous = &candidate;
+            i++;
+            continue;
+        }
+
+        // Nothing starting with the first depth characters of this word can
+        // match, so skip every following word that shares them too.  The
+        // rows up to depth remain valid for whichever word comes next.
+        std::size_t deadLength = depth;
+        auto next = std::partition_point(
+            sortedWords.begin() + i + 1, sortedWords.end(),
+            [&](const std::string& w) { return w.compare(0, deadLength, candidate, 0, deadLength) == 0; });
+
+        previous = &candidate;
+        i = next - sortedWords.begin();
+
+        // The next word shares at most deadLength - 1 characters with the
+        // dead prefix, whose rows up to there have all been computed.
+        rows.resize((deadLength + 1) * width);
+    }
+
+    return result;
+}
+
+
+void LevenshteinAutomaton::step(const unsigned int* from, char c, unsigned int* to) const noexcept
+{
+    unsigned int cap = maxDistance + 1;
+    to[0] = std::min(from[0] + 1, cap);
+
+    for(std::size_t j = 1; j <= word.size(); j++){
+        unsigned int cost = word[j-1] == c ? 0 : 1;
+        to[j] = std::min({from[j] + 1, to[j-1] + 1, from[j-1] + cost, cap});
+    }
+}
+
+
+bool LevenshteinAutomaton::canMatch(const unsigned int* state) const noexcept
+{
+    return *std::min_element(state, state + word.size() + 1) <= maxDistance;
+}
+
+
+void LevenshteinAutomaton::intersect(const TrieSet& trie, TrieSet::Position position,
+                                     std::string& prefix, std::vector<unsigned int>& rows,
+                                     std::vector<std::string>& result) const
+{
+    std::size_t width = word.size() + 1;
+    std::size_t depth = prefix.size();
+    rows.resize((depth + 2) * width);
+
+    for(TrieSet::Position c = trie.firstChild(position); c.exists(); c = trie.nextSibling(c)){
+        step(&rows[depth * width], c.letter(), &rows[(depth + 1) * width]);
+
+        const unsigned int* row = &rows[(depth + 1) * width];
+        if(!canMatch(row)){
+            continue;
+        }
+
+        prefix.push_back(c.letter());
+        if(c.isWord() && row[word.size()] <= maxDistance){
+            result.push_back(prefix);
+        }
+        intersect(trie, c, prefix, rows, result);
+        prefix.pop_back();
+
+        // The recursive call may have grown (and so moved) the buffer, but
+        // the rows up to this depth are unchanged.
+        rows.resize((depth + 2) * width);
+    }
+}
@@ -0,0 +1,85 @@
+// LevenshteinAutomaton.hpp
+//
+// A LevenshteinAutomaton recognizes the strings within a given Levenshtein
+// distance of one fixed word.  It is fed a candidate one character at a
+// time; after each character, its state says whether the characters so far
+// are within the distance (isMatch()) and whether any continuation of them
+// still could be (canMatch()).
+//
+// The automaton is simulated rather than compiled into a DFA: a state is one
+// row of the usual edit distance table, with every entry capped at
+// maxDistance + 1, since any larger value behaves the same.  That makes each
+// step O(n) in the length of the word, which is cheap for words and avoids
+// building the (much larger) DFA for every query.
+//
+// What makes the automaton useful is intersecting it with a dictionary whose
+// words share prefixes, such as a TrieSet or a sorted vector of words (for
+// example, collected by an in-order walk of an AVLSet).  The automaton is
+// stepped once per prefix rather than once per word, and a whole subtree
+// (or run of sorted words) is skipped the moment canMatch() becomes false,
+// so every word within the distance is enumerated without generating any
+// candidate strings at all.
+
+#ifndef LEVENSHTEINAUTOMATON_HPP
+#define LEVENSHTEINAUTOMATON_HPP
+
+#include <string>
+#include <vector>
+#include "TrieSet.hpp"
+
+
+
+class LevenshteinAutomaton
+{
+public:
+    using State = std::vector<unsigned int>;
+
+public:
+    // Initializes an automaton recognizing the strings within maxDistance
+    // of the given word.
+    LevenshteinAutomaton(const std::string& word, unsigned int maxDistance);
+
+
+    // start() returns the state before any characters have been given.
+    State start() const;
+
+
+    // step() returns the state that follows the given one on character c.
+    State step(const State& state, char c) const;
+
+
+    // isMatch() returns true if the characters that led to the given state
+    // are within maxDistance of the word.
+    bool isMatch(const State& state) const noexcept;
+
+
+    // canMatch() returns true if some string beginning with the characters
+    // that led to the given state is within maxDistance of the word.
+    bool canMatch(const State& state) const noexcept;
+
+
+    // intersect() returns, in sorted order, the words in the given TrieSet
+    // within maxDistance of the word.
+    std::vector<std::string> intersect(const TrieSet& trie) const;
+
+
+    // intersect() returns the words in the given vector within maxDistance
+    // of the word, in the order they appear.  The words must be sorted.
+    std::vector<std::string> intersect(const std::vector<std::string>& sortedWords) const;
+
+
+private:
+    void step(const unsigned int* from, char c, unsigned int* to) const noexcept;
+    bool canMatch(const unsigned int* state) const noexcept;
+
+    void intersect(const TrieSet& trie, TrieSet::Position position,
+                   std::string& prefix, std::vector<unsigned int>& rows,
+                   std::vector<std::string>& result) const;
+
+    std::string word;
+    unsigned int maxDistance;
+};
+
+
+
+#endif
@@ -0,0 +1,268 @@
+// PhoneticIndex.cpp
+
+#include "PhoneticIndex.hpp"
+#include <algorithm>
+
+
+
+namespace
+{
+    bool isVowel(char c) noexcept
+    {
+        return c == 'A' || c == 'E' || c == 'I' || c == 'O' || c == 'U';
+    }
+
+
+    bool isFrontVowel(char c) noexcept
+    {
+        return c == 'E' || c == 'I' || c == 'Y';
+    }
+
+
+    // normalize() returns the word's letters in uppercase, with any run of
+    // the same letter (other than 'C') reduced to one, and with the silent
+    // first letter of an initial "KN", "GN", "PN", "AE" or "WR", and the
+    // 'H' of an initial "WH", dropped.
+    std::string normalize(const std::string& word)
+    {
+        std::string letters;
+        letters.reserve(word.size());
+
+        for(char c : word){
+            if(c >= 'a' && c <= 'z'){
+                c = static_cast<char>(c - 'a' + 'A');
+            }
+            if(c < 'A' || c > 'Z'){
+                continue;
+            }
+            if(!letters.empty() && letters.back() == c && c != 'C'){
+                continue;
+            }
+            letters.push_back(c);
+        }
+
+        std::string start = letters.substr(0, 2);
+        if(start == "KN" || start == "GN" || start == "PN" || start == "AE" || start == "WR"){
+            letters.erase(0, 1);
+        }
+        else if(start == "WH"){
+            letters.erase(1, 1);
+        }
+
+        return letters;
+    }
+}
+
+
+std::string metaphoneKey(const std::string& word)
+{
+    std::string w = normalize(word);
+    std::string key;
+    key.reserve(w.size() + 1);
+
+    // at() treats everything before and after the word as '\0', so the
+    // rules below can look around a letter without checking bounds.
+    auto at = [&](std::size_t i) { return i < w.size() ? w[i] : '\0'; };
+
+    for(std::size_t i = 0; i < w.size(); i++){
+        char c = w[i];
+        char previous = i > 0 ? w[i-1] : '\0';
+        char next = at(i+1);
+
+        switch(c){
+        case 'A': case 'E': case 'I': case 'O': case 'U':
+            if(i == 0){
+                key += c;
+            }
+            break;
+
+        case 'B':
+            // The 'B' of a final "MB", as in "DUMB", is silent.
+            if(!(previous == 'M' && i+1 == w.size())){
+                key += 'B';
+            }
+            break;
+
+        case 'C':
+            if(next == 'I' && at(i+2) == 'A'){
+                key += 'X';
+            }
+            else if(next == 'H'){
+                key += previous == 'S' ? 'K' : 'X';
+                i++;
+            }
+            else if(isFrontVowel(next)){
+                // In "SCE", "SCI" and "SCY", the 'S' already makes the sound.
+                if(previous != 'S'){
+                    key += 'S';
+                }
+            }
+            else if(next == 'K'){
+                key += 'K';
+                i++;
+            }
+            else{
+                key += 'K';
+            }
+            break;
+
+        case 'D':
+            if(next == 'G' && isFrontVowel(at(i+2))){
+                key += 'J';
+                i++;
+            }
+            else{
+                key += 'T';
+            }
+            break;
+
+        case 'G':
+            if(next == 'H' && i+2 < w.size() && !isVowel(at(i+2))){
+                // Silent, as in "NIGHT".
+            }
+            else if(next == 'N' && (i+2 == w.size() || (at(i+2) == 'E' && at(i+3) == 'D' && i+4 == w.size()))){
+                // Silent, as in "SIGN" and "SIGNED".
+            }
+            else if(isFrontVowel(next) && previous != 'G'){
+                key += 'J';
+            }
+            else{
+                key += 'K';
+            }
+            break;
+
+        case 'H':
+            // An 'H' after a vowel with none after it is silent, as is one
+            // after a 'G' ("CH", "PH", "SH" and "TH" are handled above).
+            if(previous != 'G' && !(isVowel(previous) && !isVowel(next))){
+                key += 'H';
+            }
+            break;
+
+        case 'K':
+            key += 'K';
+            break;
+
+        case 'P':
+            if(next == 'H'){
+                key += 'F';
+                i++;
+            }
+            else{
+                key += 'P';
+            }
+            break;
+
+        case 'Q':
+            key += 'K';
+            break;
+
+        case 'S':
+            if(next == 'H'){
+                key += 'X';
+                i++;
+            }
+            else if(next == 'I' && (at(i+2) == 'O' || at(i+2) == 'A')){
+                key += 'X';
+            }
+            else{
+                key += 'S';
+            }
+            break;
+
+        case 'T':
+            if(next == 'I' && (at(i+2) == 'O' || at(i+2) == 'A')){
+                key += 'X';
+            }
+            else if(next == 'H'){
+                key += '0';
+                i++;
+            }
+            else if(!(next == 'C' && at(i+2) == 'H')){
+                key += 'T';
+            }
+            break;
+
+        case 'V':
+            key += 'F';
+            break;
+
+        case 'W':
+        case 'Y':
+            if(isVowel(next)){
+                key += c;
+            }
+            break;
+
+        case 'X':
+            key += i == 0 ? "S" : "KS";
+            break;
+
+        case 'Z':
+            key += 'S';
+            break;
+
+        default:
+            // F, J, L, M, N and R sound as they're written.
+            key += c;
+            break;
+        }
+    }
+
+    return key;
+}
+
+
+
+PhoneticIndex::PhoneticIndex()
+    : words{0}, largest{0}
+{
+}
+
+
+void PhoneticIndex::add(const std::string& word)
+{
+    std::string key = metaphoneKey(word);
+    if(key.empty()){
+        return;
+    }
+
+    std::vector<std::string>& bucket = buckets[key];
+    auto position = std::lower_bound(bucket.begin(), bucket.end(), word);
+    if(position != bucket.end() && *position == word){
+        return;
+    }
+
+    bucket.insert(position, word);
+    words++;
+    largest = std::max(largest, static_cast<unsigned int>(bucket.size()));
+}
+
+
+std::vector<std::string> PhoneticIndex::findSoundAlikes(const std::string& word) const
+{
+    auto found = buckets.find(metaphoneKey(word));
+    if(found == buckets.end()){
+        return {};
+    }
+
+    return found->second;
+}
+
+
+unsigned int PhoneticIndex::size() const noexcept
+{
+    return words;
+}
+
+
+unsigned int PhoneticIndex::bucketCount() const noexcept
+{
+    return static_cast<unsigned int>(buckets.size());
+}
+
+
+unsigned int PhoneticIndex::largestBucket() const noexcept
+{
+    return largest;
+}
@@ -0,0 +1,70 @@
+// PhoneticIndex.hpp
+//
+// A PhoneticIndex groups the words of a dictionary by how they sound, so
+// that WordChecker can suggest words that a misspelling sounds like even
+// when they're many edits away from it: "FONETIK" is four edits from
+// "PHONETIC", far beyond what generating candidates can reach, but both
+// sound alike.
+//
+// How a word sounds is summarized by its Metaphone key (Lawrence Philips'
+// original algorithm), which keeps the word's consonant sounds, folding
+// together the spellings that make the same sound ("PH" and "F", "C" and
+// "K" before a hard vowel, and so on), and drops its vowels after the
+// first letter.  Words with the same key go into the same bucket of a hash
+// table, so finding a word's sound-alikes takes one lookup on its key.
+
+#ifndef PHONETICINDEX_HPP
+#define PHONETICINDEX_HPP
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+
+// metaphoneKey() returns the Metaphone key of the given word, e.g., "FNTK"
+// for both "PHONETIC" and "fonetik".  Case is ignored, and anything other
+// than the letters 'A' through 'Z' (such as an apostrophe, or the bytes
+// of a UTF-8 letter like 'ü') is skipped.  The key is never truncated.
+std::string metaphoneKey(const std::string& word);
+
+
+
+class PhoneticIndex
+{
+public:
+    // Initializes an empty PhoneticIndex.
+    PhoneticIndex();
+
+
+    // add() adds a word to the bucket for its Metaphone key.  Adding a word
+    // that's already in the index has no effect.  Words with no key at
+    // all (those with no letters) aren't added.
+    void add(const std::string& word);
+
+
+    // findSoundAlikes() returns, in sorted order, every word in the index
+    // with the same Metaphone key as the given word.
+    std::vector<std::string> findSoundAlikes(const std::string& word) const;
+
+
+    // size() returns the number of words in the index.
+    unsigned int size() const noexcept;
+
+
+    // bucketCount() returns the number of distinct keys in the index, and
+    // largestBucket() the number of words sharing the most common key.
+    unsigned int bucketCount() const noexcept;
+    unsigned int largestBucket() const noexcept;
+
+
+private:
+    // Each bucket is kept sorted, so findSoundAlikes() just copies one.
+    std::unordered_map<std::string, std::vector<std::string>> buckets;
+    unsigned int words;
+    unsigned int largest;
+};
+
+
+
+#endif
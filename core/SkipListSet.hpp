@@ -378,8 +378,8 @@ void SkipListSet<ElementType>::copy(const SkipListSet& s){
 template <typename ElementType>
 void SkipListSet<ElementType>::resize(){
     Node**list = new Node*[capacity*2+1];
-    for(int i=0; i<lv;i++){
-        list[i] = nodeList[i];
+    for(int i=0; i<capacity*2+1;i++){
+        list[i] = i<lv ? nodeList[i] : nullptr;
     }
     delete[] nodeList;
     capacity=capacity*2+1;
@@ -0,0 +1,145 @@
+// SuggestionCollector.cpp
+
+#include "SuggestionCollector.hpp"
+#include <algorithm>
+#include <cstring>
+
+
+
+namespace
+{
+    using Length = std::uint32_t;
+
+
+    std::uint64_t collectorHash(std::string_view s) noexcept
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for(char c : s){
+            hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+        }
+
+        // FNV-1a's low bits, which pick the slot, depend poorly on its last
+        // few characters, so fold the high bits down into them.
+        return hash ^ (hash >> 29);
+    }
+
+
+    std::uint32_t upperBits(std::uint64_t hash) noexcept
+    {
+        return static_cast<std::uint32_t>(hash >> 32);
+    }
+}
+
+
+SuggestionCollector::SuggestionCollector() noexcept
+    : count{0}, table{inlineSlots}, capacity{INLINE_SLOTS}, inlineSlots{}
+{
+}
+
+
+bool SuggestionCollector::add(std::string_view suggestion)
+{
+    // The table is kept at most half full, so probes stay short.
+    if((count + 1) * 2 > capacity){
+        grow();
+    }
+
+    std::uint64_t hash = collectorHash(suggestion);
+    std::size_t slot = find(suggestion, hash);
+    if(table[slot].offset != 0){
+        return false;
+    }
+
+    Length length = static_cast<Length>(suggestion.size());
+    table[slot] = Slot{static_cast<std::uint32_t>(arena.size() + 1), upperBits(hash)};
+    arena.append(reinterpret_cast<const char*>(&length), sizeof(length));
+    arena.append(suggestion);
+    count++;
+    return true;
+}
+
+
+bool SuggestionCollector::contains(std::string_view suggestion) const noexcept
+{
+    return table[find(suggestion, collectorHash(suggestion))].offset != 0;
+}
+
+
+std::size_t SuggestionCollector::size() const noexcept
+{
+    return count;
+}
+
+
+std::vector<std::string> SuggestionCollector::suggestions(SuggestionOrder order) const
+{
+    // The arena holds the suggestions in the order they were added, so
+    // they only need gathering up unless they're to be sorted.
+    if(order == SuggestionOrder::Found || count <= 1){
+        std::vector<std::string> result;
+        result.reserve(count);
+        for(std::size_t offset = 0; offset < arena.size(); offset += sizeof(Length) + result.back().size()){
+            result.emplace_back(at(offset));
+        }
+        return result;
+    }
+
+    // Sorting views of the suggestions, rather than strings, moves no
+    // characters.
+    std::vector<std::string_view> views;
+    views.reserve(count);
+    for(std::size_t offset = 0; offset < arena.size(); offset += sizeof(Length) + views.back().size()){
+        views.push_back(at(offset));
+    }
+    std::sort(views.begin(), views.end());
+
+    return std::vector<std::string>(views.begin(), views.end());
+}
+
+
+std::string_view SuggestionCollector::at(std::size_t offset) const noexcept
+{
+    Length length;
+    std::memcpy(&length, arena.data() + offset, sizeof(length));
+    return std::string_view{arena.data() + offset + sizeof(length), length};
+}
+
+
+std::size_t SuggestionCollector::find(std::string_view suggestion, std::uint64_t hash) const noexcept
+{
+    // Linear probing from the slot the hash picks, until either the
+    // suggestion or an empty slot turns up.
+    std::size_t mask = capacity - 1;
+    std::uint32_t upper = upperBits(hash);
+
+    for(std::size_t slot = hash & mask; ; slot = (slot + 1) & mask){
+        const Slot& s = table[slot];
+        if(s.offset == 0 || (s.hash == upper && at(s.offset - 1) == suggestion)){
+            return slot;
+        }
+    }
+}
+
+
+void SuggestionCollector::grow()
+{
+    std::vector<Slot> grown(capacity * 2, Slot{0, 0});
+    std::size_t mask = grown.size() - 1;
+
+    for(std::size_t i = 0; i < capacity; i++){
+        if(table[i].offset == 0){
+            continue;
+        }
+
+        // The suggestions are distinct, so only an empty slot needs finding.
+        std::size_t slot = collectorHash(at(table[i].offset - 1)) & mask;
+        while(grown[slot].offset != 0){
+            slot = (slot + 1) & mask;
+        }
+        grown[slot] = table[i];
+    }
+
+    heapSlots = std::move(grown);
+    table = heapSlots.data();
+    capacity = heapSlots.size();
+}
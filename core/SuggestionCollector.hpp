@@ -0,0 +1,96 @@
+// SuggestionCollector.hpp
+//
+// A SuggestionCollector gathers the suggestions findSuggestions() finds,
+// dropping the repeats (a word can be found by more than one technique, or
+// at more than one position).  Each suggestion is appended, after its
+// length, to a single arena string, and is identified by the offset at
+// which it begins there.  A small open-addressing hash table of those
+// offsets answers whether a suggestion has been seen, so accepting one
+// costs a hash, a probe or two, and an append, rather than a separately
+// allocated tree node.  The table starts out inside the collector itself,
+// so a few short suggestions need no allocations at all.
+//
+// The suggestions are only sorted if the caller asks for them to be, at
+// the end; otherwise they come out in the order they were first added.
+
+#ifndef SUGGESTIONCOLLECTOR_HPP
+#define SUGGESTIONCOLLECTOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+
+// SuggestionOrder says whether findSuggestions() sorts its suggestions,
+// or leaves them in the order they were found, which is the order the
+// techniques run in.
+enum class SuggestionOrder
+{
+    Sorted,
+    Found
+};
+
+
+
+class SuggestionCollector
+{
+public:
+    // Initializes an empty SuggestionCollector.
+    SuggestionCollector() noexcept;
+
+    // A SuggestionCollector's table may point into itself, so it can't be
+    // copied or moved.
+    SuggestionCollector(const SuggestionCollector&) = delete;
+    SuggestionCollector& operator=(const SuggestionCollector&) = delete;
+
+
+    // add() adds the given suggestion, unless it has been added already,
+    // and returns true if it was added.
+    bool add(std::string_view suggestion);
+
+
+    // contains() returns true if the given suggestion has been added.
+    bool contains(std::string_view suggestion) const noexcept;
+
+
+    // size() returns the number of distinct suggestions added.
+    std::size_t size() const noexcept;
+
+
+    // suggestions() returns every distinct suggestion added, in the given
+    // order.
+    std::vector<std::string> suggestions(SuggestionOrder order) const;
+
+
+private:
+    static constexpr std::size_t INLINE_SLOTS = 16;
+
+    // Each slot holds the offset in the arena of a suggestion's length,
+    // plus one, so that 0 means the slot is empty, along with the upper
+    // bits of the suggestion's hash, which rule out most mismatches
+    // without touching the arena.
+    struct Slot
+    {
+        std::uint32_t offset;
+        std::uint32_t hash;
+    };
+
+    std::string_view at(std::size_t offset) const noexcept;
+    std::size_t find(std::string_view suggestion, std::uint64_t hash) const noexcept;
+    void grow();
+
+    std::string arena;
+    std::size_t count;
+
+    Slot* table;
+    std::size_t capacity;
+    Slot inlineSlots[INLINE_SLOTS];
+    std::vector<Slot> heapSlots;
+};
+
+
+
+#endif
@@ -0,0 +1,390 @@
+// SuggestionTechniques.hpp
+//
+// The five techniques from the project write-up -- swapping adjacent
+// characters, inserting a letter, deleting a character, replacing a
+// character with a letter, and splitting a word in two -- as function
+// templates that WordChecker and BasicWordChecker share.  Each takes an
+// exists function to look candidates up with, so a BasicWordChecker can
+// pass one that calls its concrete Set's contains() directly, where it can
+// be inlined, while a WordChecker looks candidates up through the virtual
+// Set<std::string> interface.
+//
+// Each technique calls visit(suggestion, technique) for every suggestion
+// it finds; the same suggestion can be visited more than once, and the
+// string passed to visit may be a scratch buffer that is reused
+// afterward.  budget.spend() is called before every lookup, and the
+// techniques stop for good as soon as it returns false.
+
+#ifndef SUGGESTIONTECHNIQUES_HPP
+#define SUGGESTIONTECHNIQUES_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Alphabet.hpp"
+
+
+
+// SuggestionTechnique identifies which of the five techniques produced a
+// suggestion.  The techniques are listed (and run) in the order of the
+// project write-up, which is also the order in which they're preferred
+// when ranking suggestions of equal frequency.
+enum class SuggestionTechnique
+{
+    Swap,
+    Insert,
+    Delete,
+    Replace,
+    Split
+};
+
+
+
+// UnlimitedBudget is the budget to give the techniques when there isn't
+// one.  It never says no, so the checks compile away.
+struct UnlimitedBudget
+{
+    static constexpr bool spend() noexcept
+    {
+        return true;
+    }
+};
+
+
+
+// isAsciiWord() returns true if every character in the given word is a
+// single byte.
+inline bool isAsciiWord(const std::string& word) noexcept
+{
+    for(char c : word){
+        if(static_cast<unsigned char>(c) >= 0x80){
+            return false;
+        }
+    }
+    return true;
+}
+
+
+
+namespace impl_
+{
+    // A SuggestionTechniques__Boundary describes a position in a word
+    // being segmented: the fewest words its beginning up to there splits
+    // into, the boundary before the last of those words, and whether the
+    // word's first or last part (up to or from there) is a word of its own.
+    struct SuggestionTechniques__Boundary
+    {
+        static constexpr unsigned int UNREACHED = ~0u;
+
+        unsigned int fewest = UNREACHED;
+        std::size_t previous = 0;
+        bool endsFirstWord = false;
+        bool startsLastWord = false;
+    };
+
+
+    constexpr std::size_t SuggestionTechniques__BOUNDARIES_ON_STACK = 32;
+}
+
+
+// forEachSegmentation() is the dynamic program behind the fifth technique.
+// It visits the word split in two at every position where both halves are
+// words and, if the fewest words the whole of it can be split into is
+// three or more (as for "THEQUICKBROWNFOX"), split into those words.  When
+// there's more than one way to split it into that few words, the one
+// whose last word is longest is chosen (and so on, working backward).
+//
+// wordsFrom(start, found) must call found(end) for every end at which the
+// word's characters from start make a word, except the whole word itself,
+// which isn't a split.  It returns false if the budget ran out, which
+// stops the technique.  It's only called for starts that some sequence of
+// words reaches from the beginning, and only once for each, in increasing
+// order; so each substring is looked up at most once, for O(n^2) lookups
+// at worst, where nesting the two-way split would take exponentially many.
+template <typename WordsFrom, typename Visit>
+void forEachSegmentation(const std::string& word, WordsFrom wordsFrom, Visit visit)
+{
+    using Boundary = impl_::SuggestionTechniques__Boundary;
+    constexpr unsigned int UNREACHED = Boundary::UNREACHED;
+
+    // boundaries[i] describes the position before the word's ith byte.
+    // They're kept on the stack, unless the word is too long for that.
+    Boundary onStack[impl_::SuggestionTechniques__BOUNDARIES_ON_STACK];
+    std::vector<Boundary> onHeap;
+    Boundary* boundaries = onStack;
+    if(word.size() + 1 > impl_::SuggestionTechniques__BOUNDARIES_ON_STACK){
+        onHeap.resize(word.size() + 1);
+        boundaries = onHeap.data();
+    }
+    boundaries[0].fewest = 0;
+
+    for(std::size_t start = 0; start < word.size(); start++){
+        if(boundaries[start].fewest == UNREACHED){
+            continue;
+        }
+
+        bool finished = wordsFrom(start, [&](std::size_t end)
+        {
+            Boundary& boundary = boundaries[end];
+            if(boundaries[start].fewest + 1 < boundary.fewest){
+                boundary.fewest = boundaries[start].fewest + 1;
+                boundary.previous = start;
+            }
+            if(start == 0){
+                boundary.endsFirstWord = true;
+            }
+            if(end == word.size()){
+                boundaries[start].startsLastWord = true;
+            }
+        });
+        if(!finished){
+            return;
+        }
+    }
+
+    for(std::size_t a = 1; a < word.size(); a++){
+        if(boundaries[a].endsFirstWord && boundaries[a].startsLastWord){
+            visit(word.substr(0, a) + ' ' + word.substr(a), SuggestionTechnique::Split);
+        }
+    }
+
+    // The spaces go in from the end backward, so each one's position in
+    // the word is still right when it's inserted.
+    if(boundaries[word.size()].fewest != UNREACHED && boundaries[word.size()].fewest >= 3){
+        std::string segmented = word;
+        for(std::size_t b = boundaries[word.size()].previous; b != 0; b = boundaries[b].previous){
+            segmented.insert(b, 1, ' ');
+        }
+        visit(segmented, SuggestionTechnique::Split);
+    }
+}
+
+
+// forEachSplit() applies the fifth technique by looking up substrings of
+// the word, which begin and end only between its characters, never within
+// one.  If exists can take a std::string_view, it's given views of the
+// word, rather than copies of the substrings.
+template <typename Exists, typename Visit, typename Budget>
+void forEachSplit(const std::string& word, Exists exists, Visit visit, Budget&& budget)
+{
+    constexpr bool looksUpViews = std::is_invocable_r_v<bool, Exists&, std::string_view>;
+
+    std::string part;
+    if constexpr(!looksUpViews){
+        part.reserve(word.size());
+    }
+
+    forEachSegmentation(word, [&](std::size_t start, auto found)
+    {
+        for(std::size_t end = start + 1; end <= word.size(); end++){
+            if(end < word.size() && isUtf8ContinuationByte(word[end])){
+                continue;
+            }
+            if(start == 0 && end == word.size()){
+                break;
+            }
+            if(!budget.spend()){
+                return false;
+            }
+            if constexpr(looksUpViews){
+                if(exists(std::string_view{word}.substr(start, end - start))){
+                    found(end);
+                }
+            }
+            else{
+                part.assign(word, start, end - start);
+                if(exists(part)){
+                    found(end);
+                }
+            }
+        }
+        return true;
+    }, visit);
+}
+
+
+// forEachByteSuggestion() applies all five techniques a byte at a time,
+// which is only right when the word and the alphabet are both ASCII.
+template <typename Alphabet, typename Exists, typename Visit, typename Budget>
+void forEachByteSuggestion(const std::string& word, Exists exists, Visit visit, Budget&& budget)
+{
+    // Every technique below edits one scratch copy of the word in place,
+    // checks it, and then undoes its edit, rather than building a fresh
+    // std::string for every candidate.  The scratch buffer has room for one
+    // extra character up front, so none of the edits ever reallocate it, and
+    // words short enough for the small-string buffer allocate nothing at all
+    // until a suggestion is actually found.
+    std::string scratch;
+    scratch.reserve(word.size() + 1);
+    scratch = word;
+
+    //First technique
+    for(std::size_t i = 0; i+1 < word.size(); i++){
+        std::swap(scratch[i], scratch[i+1]);
+        if(!budget.spend()){
+            return;
+        }
+        if(exists(scratch)){
+            visit(scratch, SuggestionTechnique::Swap);
+        }
+        std::swap(scratch[i], scratch[i+1]);
+    }
+
+    //Second technique
+    for(std::size_t k = 0; k <= word.size(); k++){
+        scratch.insert(k, 1, Alphabet::letters[0]);
+        for(char j : Alphabet::letters){
+            scratch[k] = j;
+            if(!budget.spend()){
+                return;
+            }
+            if(exists(scratch)){
+                visit(scratch, SuggestionTechnique::Insert);
+            }
+        }
+        scratch.erase(k, 1);
+    }
+
+    //Third technique
+    for(std::size_t m = 0; m < word.size(); m++){
+        scratch.erase(m, 1);
+        if(!budget.spend()){
+            return;
+        }
+        if(exists(scratch)){
+            visit(scratch, SuggestionTechnique::Delete);
+        }
+        scratch.insert(m, 1, word[m]);
+    }
+
+    //Fourth technique
+    // Replacing "past the end" of the word is the same as inserting at the
+    // end, which the second technique has already covered.
+    for(std::size_t n = 0; n < word.size(); n++){
+        for(char l : Alphabet::letters){
+            scratch[n] = l;
+            if(!budget.spend()){
+                return;
+            }
+            if(exists(scratch)){
+                visit(scratch, SuggestionTechnique::Replace);
+            }
+        }
+        scratch[n] = word[n];
+    }
+
+    //Fifth technique
+    forEachSplit(word, exists, visit, budget);
+}
+
+
+// forEachCharacterEdit() calls visit(candidate, technique) for every string
+// one swap, insertion, deletion or replacement of a UTF-8 character away
+// from the word, without looking any of them up; each still spends one
+// lookup from the budget, since visit usually looks it up.
+template <typename Alphabet, typename Visit, typename Budget>
+void forEachCharacterEdit(const std::string& word, Visit visit, Budget&& budget)
+{
+    // starts[i] is the offset of the byte at which the word's ith character
+    // begins, and starts.back() is the word's size, so every technique
+    // moves, removes or replaces whole characters rather than bytes.  A
+    // byte that isn't valid UTF-8 is treated as a character of its own.
+    std::vector<std::size_t> starts;
+    for(std::size_t i = 0; i < word.size(); i++){
+        if(i == 0 || !isUtf8ContinuationByte(word[i])){
+            starts.push_back(i);
+        }
+    }
+    std::size_t count = starts.size();
+    starts.push_back(word.size());
+
+    auto length = [&](std::size_t i) { return starts[i+1] - starts[i]; };
+
+    std::string scratch;
+    scratch.reserve(word.size() + 4);
+
+    //First technique
+    for(std::size_t i = 0; i+1 < count; i++){
+        scratch.assign(word, 0, starts[i]);
+        scratch.append(word, starts[i+1], length(i+1));
+        scratch.append(word, starts[i], length(i));
+        scratch.append(word, starts[i+2], std::string::npos);
+        if(!budget.spend()){
+            return;
+        }
+        visit(scratch, SuggestionTechnique::Swap);
+    }
+
+    // The inserted or replacing letter is held in a gap in the scratch
+    // buffer, which is only resized when a letter's length differs from the
+    // last one's; otherwise the letter's bytes just overwrite the gap.
+
+    //Second technique
+    scratch = word;
+    for(std::size_t k = 0; k <= count; k++){
+        std::size_t held = 0;
+        for(std::string_view letter : alphabetCodePoints<Alphabet>()){
+            if(letter.size() != held){
+                scratch.replace(starts[k], held, letter.size(), '\0');
+                held = letter.size();
+            }
+            letter.copy(&scratch[starts[k]], held);
+            if(!budget.spend()){
+                return;
+            }
+            visit(scratch, SuggestionTechnique::Insert);
+        }
+        scratch.erase(starts[k], held);
+    }
+
+    //Third technique
+    for(std::size_t m = 0; m < count; m++){
+        scratch.assign(word, 0, starts[m]);
+        scratch.append(word, starts[m+1], std::string::npos);
+        if(!budget.spend()){
+            return;
+        }
+        visit(scratch, SuggestionTechnique::Delete);
+    }
+
+    //Fourth technique
+    scratch = word;
+    for(std::size_t n = 0; n < count; n++){
+        std::size_t held = length(n);
+        for(std::string_view letter : alphabetCodePoints<Alphabet>()){
+            if(letter.size() != held){
+                scratch.replace(starts[n], held, letter.size(), '\0');
+                held = letter.size();
+            }
+            letter.copy(&scratch[starts[n]], held);
+            if(!budget.spend()){
+                return;
+            }
+            visit(scratch, SuggestionTechnique::Replace);
+        }
+        scratch.replace(starts[n], held, word, starts[n], length(n));
+    }
+}
+
+
+// forEachCharacterSuggestion() applies all five techniques a whole UTF-8
+// character at a time.
+template <typename Alphabet, typename Exists, typename Visit, typename Budget>
+void forEachCharacterSuggestion(const std::string& word, Exists exists, Visit visit, Budget&& budget)
+{
+    forEachCharacterEdit<Alphabet>(word, [&](const std::string& candidate, SuggestionTechnique technique)
+    {
+        if(exists(candidate)){
+            visit(candidate, technique);
+        }
+    }, budget);
+
+    forEachSplit(word, exists, visit, budget);
+}
+
+
+
+#endif
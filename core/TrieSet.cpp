@@ -0,0 +1,214 @@
+// TrieSet.cpp
+
+#include "TrieSet.hpp"
+#include <utility>
+
+
+
+namespace
+{
+    // Siblings are sorted by their characters' values as unsigned chars,
+    // which is the order std::string compares them in, so that a walk of
+    // the trie visits words in the same order as sorting them would
+    // (including words with bytes above 0x7F, such as UTF-8 letters).
+    bool comesBefore(char a, char b) noexcept
+    {
+        return static_cast<unsigned char>(a) < static_cast<unsigned char>(b);
+    }
+}
+
+
+
+TrieSet::Position::Position(const Node* node) noexcept
+    : node{node}
+{
+}
+
+
+bool TrieSet::Position::exists() const noexcept
+{
+    return node != nullptr;
+}
+
+
+bool TrieSet::Position::isWord() const noexcept
+{
+    return node != nullptr && node->isWord;
+}
+
+
+char TrieSet::Position::letter() const noexcept
+{
+    return node->letter;
+}
+
+
+TrieSet::TrieSet()
+    : start{new Node{'\0', false, nullptr, nullptr}}, sz{0}
+{
+}
+
+
+TrieSet::~TrieSet() noexcept
+{
+    clear(start);
+}
+
+
+TrieSet::TrieSet(const TrieSet& s)
+    : start{copy(s.start)}, sz{s.sz}
+{
+}
+
+
+TrieSet::TrieSet(TrieSet&& s) noexcept
+    : start{new Node{'\0', false, nullptr, nullptr}}, sz{0}
+{
+    std::swap(start, s.start);
+    std::swap(sz, s.sz);
+}
+
+
+TrieSet& TrieSet::operator=(const TrieSet& s)
+{
+    if(this != &s){
+        // Copy first, so a failure part way through leaves this set as
+        // it was.
+        Node* newStart = copy(s.start);
+        clear(start);
+        start = newStart;
+        sz = s.sz;
+    }
+    return *this;
+}
+
+
+TrieSet& TrieSet::operator=(TrieSet&& s) noexcept
+{
+    std::swap(start, s.start);
+    std::swap(sz, s.sz);
+    return *this;
+}
+
+
+bool TrieSet::isImplemented() const noexcept
+{
+    return true;
+}
+
+
+void TrieSet::add(const std::string& element)
+{
+    Node* current = start;
+
+    for(char c : element){
+        // Find the child for c, or the place in the sorted list of
+        // siblings where it belongs.
+        Node** link = &current->firstChild;
+        while(*link != nullptr && comesBefore((*link)->letter, c)){
+            link = &(*link)->nextSibling;
+        }
+        if(*link == nullptr || (*link)->letter != c){
+            *link = new Node{c, false, nullptr, *link};
+        }
+        current = *link;
+    }
+
+    if(!current->isWord){
+        current->isWord = true;
+        sz++;
+    }
+}
+
+
+bool TrieSet::contains(const std::string& element) const
+{
+    return follow(root(), element).isWord();
+}
+
+
+unsigned int TrieSet::size() const noexcept
+{
+    return sz;
+}
+
+
+TrieSet::Position TrieSet::root() const noexcept
+{
+    return Position{start};
+}
+
+
+TrieSet::Position TrieSet::child(Position position, char c) const noexcept
+{
+    if(position.node == nullptr){
+        return position;
+    }
+
+    const Node* current = position.node->firstChild;
+    while(current != nullptr && comesBefore(current->letter, c)){
+        current = current->nextSibling;
+    }
+
+    return Position{current != nullptr && current->letter == c ? current : nullptr};
+}
+
+
+TrieSet::Position TrieSet::follow(Position position, const std::string& s, std::size_t from) const noexcept
+{
+    for(std::size_t i = from; i < s.size() && position.exists(); i++){
+        position = child(position, s[i]);
+    }
+
+    return position;
+}
+
+
+TrieSet::Position TrieSet::firstChild(Position position) const noexcept
+{
+    return Position{position.node == nullptr ? nullptr : position.node->firstChild};
+}
+
+
+TrieSet::Position TrieSet::nextSibling(Position position) const noexcept
+{
+    return Position{position.node == nullptr ? nullptr : position.node->nextSibling};
+}
+
+
+void TrieSet::clear(Node* n) noexcept
+{
+    // Siblings are deleted iteratively, so only the depth of the trie (the
+    // length of the longest word) is limited by the stack.
+    while(n != nullptr){
+        clear(n->firstChild);
+        Node* next = n->nextSibling;
+        delete n;
+        n = next;
+    }
+}
+
+
+TrieSet::Node* TrieSet::copy(const Node* n)
+{
+    if(n == nullptr){
+        return nullptr;
+    }
+
+    Node* result = new Node{n->letter, n->isWord, nullptr, nullptr};
+    try{
+        Node** link = &result->nextSibling;
+        result->firstChild = copy(n->firstChild);
+        for(const Node* sibling = n->nextSibling; sibling != nullptr; sibling = sibling->nextSibling){
+            *link = new Node{sibling->letter, sibling->isWord, nullptr, nullptr};
+            (*link)->firstChild = copy(sibling->firstChild);
+            link = &(*link)->nextSibling;
+        }
+    }
+    catch(...){
+        clear(result);
+        throw;
+    }
+
+    return result;
+}
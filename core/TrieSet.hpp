@@ -0,0 +1,142 @@
+// TrieSet.hpp
+//
+// A TrieSet is an implementation of a Set of strings that is a trie: a tree
+// in which each node represents a prefix, each edge adds one character to
+// the prefix, and each node is marked if its prefix is itself a word in the
+// set.  The children of each node are kept in a singly-linked list of
+// siblings, sorted by character (compared as unsigned chars, as
+// std::string compares them), so a node only pays for the children it
+// actually has.
+//
+// Besides the usual Set operations, a TrieSet lets its users walk it one
+// character at a time, using Positions.  A Position represents the node
+// reached by following some prefix from the root, or the fact that no word
+// in the set starts with that prefix.  This lets a caller that is building
+// candidate words a character at a time (as WordChecker does) abandon a
+// candidate as soon as its prefix leads nowhere, and enumerate only the
+// characters that can actually follow a prefix, rather than trying every
+// possible one.
+
+#ifndef TRIESET_HPP
+#define TRIESET_HPP
+
+#include <string>
+#include "Set.hpp"
+
+
+
+class TrieSet : public Set<std::string>
+{
+private:
+    struct Node;
+
+public:
+    // A Position is a place in the trie reached by following a prefix.
+    class Position
+    {
+    public:
+        // exists() returns true if at least one word in the set starts
+        // with the prefix that led to this Position.
+        bool exists() const noexcept;
+
+        // isWord() returns true if the prefix that led to this Position is
+        // itself a word in the set.
+        bool isWord() const noexcept;
+
+        // letter() returns the last character of the prefix that led to
+        // this Position.  The Position must exist and not be the root.
+        char letter() const noexcept;
+
+    private:
+        explicit Position(const Node* node) noexcept;
+
+        const Node* node;
+
+        friend class TrieSet;
+    };
+
+public:
+    // Initializes a TrieSet to be empty.
+    TrieSet();
+
+    // Cleans up the TrieSet so that it leaks no memory.
+    ~TrieSet() noexcept override;
+
+    // Initializes a new TrieSet to be a copy of an existing one.
+    TrieSet(const TrieSet& s);
+
+    // Initializes a new TrieSet whose contents are moved from an
+    // expiring one.
+    TrieSet(TrieSet&& s) noexcept;
+
+    // Assigns an existing TrieSet into another.
+    TrieSet& operator=(const TrieSet& s);
+
+    // Assigns an expiring TrieSet into another.
+    TrieSet& operator=(TrieSet&& s) noexcept;
+
+
+    // isImplemented() returns true, since TrieSet is implemented.
+    bool isImplemented() const noexcept override;
+
+
+    // add() adds an element to the set.  If the element is already in the
+    // set, this function has no effect.  This function runs in O(m) time
+    // for an element of length m (times the alphabet size, in the worst
+    // case, since siblings are found by walking a list).
+    void add(const std::string& element) override;
+
+
+    // contains() returns true if the given element is already in the set,
+    // false otherwise.  This function runs in the same time as add().
+    bool contains(const std::string& element) const override;
+
+
+    // size() returns the number of elements in the set.
+    unsigned int size() const noexcept override;
+
+
+    // root() returns the Position of the empty prefix.
+    Position root() const noexcept;
+
+
+    // child() returns the Position reached by adding the given character
+    // to the prefix that led to the given Position.  If the given Position
+    // doesn't exist, neither does the result.
+    Position child(Position position, char c) const noexcept;
+
+
+    // follow() returns the Position reached by adding the characters of s,
+    // from index "from" to the end, to the prefix that led to the given
+    // Position.  It stops as soon as a Position doesn't exist.
+    Position follow(Position position, const std::string& s, std::size_t from = 0) const noexcept;
+
+
+    // firstChild() and nextSibling() walk the characters that can follow a
+    // prefix, in ascending order: firstChild() returns the first child of
+    // the given Position, and nextSibling() returns the child of the same
+    // parent that follows the given one.  Either returns a Position that
+    // doesn't exist when there are no more children.
+    Position firstChild(Position position) const noexcept;
+    Position nextSibling(Position position) const noexcept;
+
+
+private:
+    struct Node
+    {
+        char letter;
+        bool isWord;
+        Node* firstChild;
+        Node* nextSibling;
+    };
+
+    void clear(Node* n) noexcept;
+    Node* copy(const Node* n);
+
+    Node* start;
+    unsigned int sz;
+};
+
+
+
+#endif
@@ -7,88 +7,884 @@
 // the requirements.
 
 #include "WordChecker.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+
+
+namespace
+{
+    // LookupBudget enforces a SuggestionBudget.  Reading the clock costs
+    // about as much as a lookup, so the deadline is only checked every
+    // CLOCK_INTERVAL lookups.
+    class LookupBudget
+    {
+    public:
+        static constexpr unsigned int CLOCK_INTERVAL = 32;
+
+        explicit LookupBudget(const SuggestionBudget& budget)
+            : maxLookups{budget.maxLookups}, deadline{budget.deadline},
+              hasDeadline{budget.deadline != std::chrono::steady_clock::time_point::max()},
+              used{0}, untilClockCheck{0}, exhausted{false}
+        {
+        }
+
+        bool spend()
+        {
+            if(exhausted){
+                return false;
+            }
+
+            if(maxLookups != 0 && used == maxLookups){
+                exhausted = true;
+                return false;
+            }
+
+            if(hasDeadline){
+                if(untilClockCheck == 0){
+                    if(std::chrono::steady_clock::now() >= deadline){
+                        exhausted = true;
+                        return false;
+                    }
+                    untilClockCheck = CLOCK_INTERVAL;
+                }
+                untilClockCheck--;
+            }
+
+            used++;
+            return true;
+        }
+
+        bool wasExhausted() const noexcept
+        {
+            return exhausted;
+        }
+
+    private:
+        unsigned long long maxLookups;
+        std::chrono::steady_clock::time_point deadline;
+        bool hasDeadline;
+        unsigned long long used;
+        unsigned int untilClockCheck;
+        bool exhausted;
+    };
+
+
+    template <typename T>
+    struct AlphabetTag
+    {
+        using Alphabet = T;
+    };
+
+
+    // withAlphabet() calls function with an AlphabetTag for the alphabet
+    // the given SuggestionAlphabet names.  The alphabet is chosen once here,
+    // so each technique's candidate loop is compiled separately for each
+    // alphabet's exact letters.
+    template <typename Function>
+    void withAlphabet(SuggestionAlphabet alphabet, Function function)
+    {
+        switch(alphabet){
+        case SuggestionAlphabet::Uppercase:
+            function(AlphabetTag<UppercaseAlphabet>{});
+            break;
+        case SuggestionAlphabet::Lowercase:
+            function(AlphabetTag<LowercaseAlphabet>{});
+            break;
+        case SuggestionAlphabet::LowercaseApostrophe:
+            function(AlphabetTag<LowercaseApostropheAlphabet>{});
+            break;
+        case SuggestionAlphabet::MixedCase:
+            function(AlphabetTag<MixedCaseAlphabet>{});
+            break;
+        case SuggestionAlphabet::MixedCaseApostrophe:
+            function(AlphabetTag<MixedCaseApostropheAlphabet>{});
+            break;
+        case SuggestionAlphabet::Alphanumeric:
+            function(AlphabetTag<AlphanumericAlphabet>{});
+            break;
+        case SuggestionAlphabet::German:
+            function(AlphabetTag<GermanAlphabet>{});
+            break;
+        case SuggestionAlphabet::French:
+            function(AlphabetTag<FrenchAlphabet>{});
+            break;
+        }
+    }
+}
 
 
 
 WordChecker::WordChecker(const Set<std::string>& words)
-    : words{words}
+    : words{words}, trie{dynamic_cast<const TrieSet*>(&words)}, bkTree{nullptr}, sortedWords{nullptr}, frequencies{nullptr},
+      deletionIndex{nullptr}, phoneticIndex{nullptr},
+      bloomFilter{nullptr}, countBloomLookups{false}, bloomRejected{0}, bloomPassed{0}, bloomFalsePositives{0},
+      alphabet{SuggestionAlphabet::Uppercase}
 {
 }
 
 
 bool WordChecker::wordExists(const std::string& word) const
 {
-    if(words.contains(word)){
-        return true;
+    if(bloomFilter == nullptr){
+        return words.contains(word);
+    }
+
+    bool mightContain = bloomFilter->mightContain(word);
+    bool exists = mightContain && words.contains(word);
+
+    // The counters are only statistics, so relaxed increments are enough
+    // even when a batch of findSuggestions() calls runs on several threads.
+    if(countBloomLookups){
+        if(!mightContain){
+            bloomRejected.fetch_add(1, std::memory_order_relaxed);
+        }
+        else{
+            bloomPassed.fetch_add(1, std::memory_order_relaxed);
+            if(!exists){
+                bloomFalsePositives.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    return exists;
+}
+
+
+void WordChecker::useBloomFilter(const BloomFilter& filter, bool countLookups)
+{
+    bloomFilter = &filter;
+    countBloomLookups = countLookups;
+    resetBloomFilterStats();
+}
+
+
+BloomFilterStats WordChecker::bloomFilterStats() const noexcept
+{
+    return BloomFilterStats{
+        bloomRejected.load(std::memory_order_relaxed),
+        bloomPassed.load(std::memory_order_relaxed),
+        bloomFalsePositives.load(std::memory_order_relaxed)};
+}
+
+
+void WordChecker::resetBloomFilterStats() noexcept
+{
+    bloomRejected.store(0, std::memory_order_relaxed);
+    bloomPassed.store(0, std::memory_order_relaxed);
+    bloomFalsePositives.store(0, std::memory_order_relaxed);
+}
+
+
+void WordChecker::enableSuggestionCache(unsigned int capacity)
+{
+    if(capacity == 0){
+        suggestionCache.reset();
     }
     else{
-        return false;
+        suggestionCache = std::make_unique<LRUCache<std::string, std::vector<std::string>>>(capacity);
     }
 }
 
 
+void WordChecker::invalidateSuggestionCache()
+{
+    if(suggestionCache != nullptr){
+        suggestionCache->clear();
+    }
+}
+
+
+LRUCacheStats WordChecker::suggestionCacheStats() const
+{
+    if(suggestionCache == nullptr){
+        return LRUCacheStats{0, 0, 0, 0, 0};
+    }
+
+    return suggestionCache->stats();
+}
+
+
 std::vector<std::string> WordChecker::findSuggestions(const std::string& word) const
 {
-    // Nonsensical code because the compiler requires the member variables
-    // 'words' to be used somewhere, or else it becomes a warning (which
-    // turns into an error).
+    return findSuggestions(word, SuggestionOrder::Sorted);
+}
+
+
+std::vector<std::string> WordChecker::findSuggestions(const std::string& word, SuggestionOrder order) const
+{
+    if(suggestionCache == nullptr){
+        return generateSuggestions(word, order);
+    }
+
+    // The cache only holds sorted suggestions, which will do for any
+    // order, but unsorted ones can't be put into it.
     std::vector<std::string> result;
-    std::set<std::string> tempSet;
-    
-    for(int i=0; i<word.size()-1; i++){
-        //First technique
-        std::string newWord = word.substr(0, i)+word[i+1]+word[i]+word.substr(i+2);
-        if(wordExists(newWord)){
-            tempSet.insert(newWord);
+    if(!suggestionCache->get(word, result)){
+        result = generateSuggestions(word, order);
+        if(order == SuggestionOrder::Sorted){
+            suggestionCache->put(word, result);
         }
+    }
+    return result;
+}
+
+
+PartialSuggestions WordChecker::findSuggestions(const std::string& word, const SuggestionBudget& budget) const
+{
+    std::vector<std::string> cached;
+    if(suggestionCache != nullptr && suggestionCache->get(word, cached)){
+        return PartialSuggestions{std::move(cached), false};
+    }
+
+    LookupBudget lookups{budget};
+    SuggestionCollector collector;
+    forEachSuggestion(word, [&](const std::string& suggestion, SuggestionTechnique)
+    {
+        collector.add(suggestion);
+    }, lookups);
+
+    PartialSuggestions result{collector.suggestions(SuggestionOrder::Sorted), lookups.wasExhausted()};
 
+    // Only complete suggestions can be cached.
+    if(!result.partial && suggestionCache != nullptr){
+        suggestionCache->put(word, result.suggestions);
+    }
+    return result;
+}
+
+
+void WordChecker::useAlphabet(SuggestionAlphabet alphabet)
+{
+    this->alphabet = alphabet;
+    invalidateSuggestionCache();
+}
+
+
+template <typename Visit, typename Budget>
+void WordChecker::forEachSuggestion(const std::string& word, Visit visit, Budget&& budget) const
+{
+    withAlphabet(alphabet, [&](auto tag)
+    {
+        forEachSuggestionIn<typename decltype(tag)::Alphabet>(word, visit, budget);
+    });
+}
+
+
+template <typename Alphabet, typename Visit, typename Budget>
+void WordChecker::forEachSuggestionIn(const std::string& word, Visit visit, Budget&& budget) const
+{
+    static_assert(!Alphabet::letters.empty(), "an alphabet needs at least one letter");
+
+    auto exists = [this](const std::string& candidate)
+    {
+        return wordExists(candidate);
+    };
+
+    // Editing the word a byte at a time is only right when every character
+    // in it, and every letter that might be inserted, is a single byte.
+    if(!alphabetIsAscii<Alphabet>() || !isAsciiWord(word)){
+        forEachCharacterSuggestion<Alphabet>(word, exists, visit, budget);
+        return;
+    }
+
+    if(trie != nullptr){
+        forEachSuggestionInTrie<Alphabet>(word, visit, budget);
+        return;
+    }
 
+    forEachByteSuggestion<Alphabet>(word, exists, visit, budget);
+}
+
+
+template <typename Alphabet, typename Visit, typename Budget>
+void WordChecker::forEachSuggestionInTrie(const std::string& word, Visit visit, Budget&& budget) const
+{
+    // prefixes[i] is where the first i characters of the word lead in the
+    // trie.  Every technique leaves some prefix of the word unchanged, so
+    // it starts from there rather than from the root, and gives up at once
+    // when that prefix begins no word at all.
+    using Position = TrieSet::Position;
+    std::vector<Position> prefixes{trie->root()};
+    for(std::size_t i = 0; i < word.size(); i++){
+        prefixes.push_back(trie->child(prefixes.back(), word[i]));
+    }
 
+    std::string scratch;
+    scratch.reserve(word.size() + 1);
+    scratch = word;
+
+    //First technique
+    for(std::size_t i = 0; i+1 < word.size() && prefixes[i].exists(); i++){
+        if(!budget.spend()){
+            return;
+        }
+        Position p = trie->child(trie->child(prefixes[i], word[i+1]), word[i]);
+        if(trie->follow(p, word, i+2).isWord()){
+            std::swap(scratch[i], scratch[i+1]);
+            visit(scratch, SuggestionTechnique::Swap);
+            std::swap(scratch[i], scratch[i+1]);
+        }
     }
-    
+
     //Second technique
-    for(int k=0; k<=word.size();k++){
-        for(char j = 'A'; j<='Z';j++){
-            std::string myWord = word;
-            
-            std::string testWord = myWord.insert(k, 1, j);
-            if(wordExists(testWord)){
-                tempSet.insert(testWord);
+    for(std::size_t k = 0; k <= word.size() && prefixes[k].exists(); k++){
+        for(Position c = trie->firstChild(prefixes[k]); c.exists(); c = trie->nextSibling(c)){
+            if(!budget.spend()){
+                return;
+            }
+            if(alphabetContains<Alphabet>(c.letter()) && trie->follow(c, word, k).isWord()){
+                scratch.insert(k, 1, c.letter());
+                visit(scratch, SuggestionTechnique::Insert);
+                scratch.erase(k, 1);
             }
         }
     }
 
     //Third technique
-    for(int m = 0; m<word.size(); m++){
-        std::string deleteWord = word;
-        deleteWord.erase(m,1);
-        if(wordExists(deleteWord)){
-            tempSet.insert(deleteWord);
+    for(std::size_t m = 0; m < word.size() && prefixes[m].exists(); m++){
+        if(!budget.spend()){
+            return;
+        }
+        if(trie->follow(prefixes[m], word, m+1).isWord()){
+            scratch.erase(m, 1);
+            visit(scratch, SuggestionTechnique::Delete);
+            scratch.insert(m, 1, word[m]);
         }
     }
-    
+
     //Fourth technique
-    for(int n=0; n<=word.size();n++){
-        for(char  l= 'A'; l<='Z';l++){
-            std::string word4 = word;
-            std::string testWord4 = word4.replace(n, 1, 1, l);
-            if(wordExists(testWord4)){
-                tempSet.insert(word4);
+    for(std::size_t n = 0; n < word.size() && prefixes[n].exists(); n++){
+        for(Position c = trie->firstChild(prefixes[n]); c.exists(); c = trie->nextSibling(c)){
+            if(!budget.spend()){
+                return;
+            }
+            if(alphabetContains<Alphabet>(c.letter()) && trie->follow(c, word, n+1).isWord()){
+                scratch[n] = c.letter();
+                visit(scratch, SuggestionTechnique::Replace);
+                scratch[n] = word[n];
             }
         }
     }
-    
+
     //Fifth technique
-    for(int a= 1; a<word.size();a++){
-        std::string word5 = word;
-        std::string testWord5 = word5.insert(a, 1, ' ');
-        if(wordExists(testWord5.substr(0, a)) && wordExists(testWord5.substr(a+1))){
-            tempSet.insert(testWord5);
+    // Each substring is found by walking down the trie from its start, so
+    // the walk from a start stops at the first prefix that begins no word.
+    forEachSegmentation(word, [&](std::size_t start, auto found)
+    {
+        Position p = trie->root();
+        for(std::size_t end = start + 1; end <= word.size(); end++){
+            if(start == 0 && end == word.size()){
+                break;
+            }
+            if(!budget.spend()){
+                return false;
+            }
+            p = trie->child(p, word[end-1]);
+            if(!p.exists()){
+                break;
+            }
+            if(p.isWord()){
+                found(end);
+            }
+        }
+        return true;
+    }, visit);
+}
+
+
+SuggestionRange WordChecker::lazySuggestions(const std::string& word) const
+{
+    // The alphabets' letters are static, so the range can point into them.
+    const std::string_view* letters = nullptr;
+    std::size_t letterCount = 0;
+    withAlphabet(alphabet, [&](auto tag)
+    {
+        const auto& codePoints = alphabetCodePoints<typename decltype(tag)::Alphabet>();
+        letters = codePoints.data();
+        letterCount = codePoints.size();
+    });
+
+    return SuggestionRange{*this, word, letters, letterCount};
+}
+
+
+SuggestionRange::SuggestionRange(const WordChecker& checker, const std::string& word,
+                                 const std::string_view* letters, std::size_t letterCount)
+    : checker{&checker}, word{word}, letters{letters}, letterCount{letterCount},
+      stage{SuggestionTechnique::Swap}, position{0}, letter{0}, finished{false},
+      suggestionTechnique{SuggestionTechnique::Swap}
+{
+    // As in forEachCharacterEdit(), starts[i] is the offset of the word's ith
+    // character, and starts.back() is the word's size.
+    for(std::size_t i = 0; i < word.size(); i++){
+        if(i == 0 || !isUtf8ContinuationByte(word[i])){
+            starts.push_back(i);
         }
     }
-    for(auto iterator = tempSet.begin(); iterator != tempSet.end(); iterator++){
-        result.push_back(*iterator);
+    starts.push_back(word.size());
+
+    candidate.reserve(word.size() + 4);
+}
+
+
+bool SuggestionRange::next()
+{
+    while(!finished){
+        SuggestionTechnique technique = stage;
+        if(!makeCandidate()){
+            continue;
+        }
+
+        // The splits have already been looked up.
+        if(technique != SuggestionTechnique::Split && !checker->wordExists(candidate)){
+            continue;
+        }
+
+        if(seen.insert(candidate).second){
+            suggestion = candidate;
+            suggestionTechnique = technique;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+bool SuggestionRange::makeCandidate()
+{
+    // Each call makes at most one candidate and moves the state on to the
+    // next; it returns false, having made nothing, when it moves on from
+    // one technique to the next.  An inserted or replacing letter the same
+    // length as the one before it just overwrites it in place.
+    std::size_t count = starts.size() - 1;
+    auto length = [&](std::size_t i) { return starts[i+1] - starts[i]; };
+
+    switch(stage){
+    //First technique
+    case SuggestionTechnique::Swap:
+        if(position+1 >= count){
+            stage = SuggestionTechnique::Insert;
+            position = 0;
+            return false;
+        }
+        candidate.assign(word, 0, starts[position]);
+        candidate.append(word, starts[position+1], length(position+1));
+        candidate.append(word, starts[position], length(position));
+        candidate.append(word, starts[position+2], std::string::npos);
+        position++;
+        return true;
+
+    //Second technique
+    case SuggestionTechnique::Insert:
+        if(position > count){
+            stage = SuggestionTechnique::Delete;
+            position = 0;
+            return false;
+        }
+        if(letter != 0 && letters[letter].size() == letters[letter-1].size()){
+            letters[letter].copy(&candidate[starts[position]], letters[letter].size());
+        }
+        else{
+            candidate.assign(word, 0, starts[position]);
+            candidate.append(letters[letter]);
+            candidate.append(word, starts[position], std::string::npos);
+        }
+        if(++letter == letterCount){
+            letter = 0;
+            position++;
+        }
+        return true;
+
+    //Third technique
+    case SuggestionTechnique::Delete:
+        if(position >= count){
+            stage = SuggestionTechnique::Replace;
+            position = 0;
+            return false;
+        }
+        candidate.assign(word, 0, starts[position]);
+        candidate.append(word, starts[position+1], std::string::npos);
+        position++;
+        return true;
+
+    //Fourth technique
+    case SuggestionTechnique::Replace:
+        if(position >= count){
+            // The splits come out of a dynamic program over the whole word,
+            // so they're all found at once, before the first is made.
+            forEachSplit(word, [this](const std::string& part)
+            {
+                return checker->wordExists(part);
+            }, [this](const std::string& split, SuggestionTechnique)
+            {
+                splits.push_back(split);
+            }, UnlimitedBudget{});
+            stage = SuggestionTechnique::Split;
+            position = 0;
+            return false;
+        }
+        if(letter != 0 && letters[letter].size() == letters[letter-1].size()){
+            letters[letter].copy(&candidate[starts[position]], letters[letter].size());
+        }
+        else{
+            candidate.assign(word, 0, starts[position]);
+            candidate.append(letters[letter]);
+            candidate.append(word, starts[position+1], std::string::npos);
+        }
+        if(++letter == letterCount){
+            letter = 0;
+            position++;
+        }
+        return true;
+
+    //Fifth technique
+    case SuggestionTechnique::Split:
+        if(position >= splits.size()){
+            finished = true;
+            return false;
+        }
+        candidate = splits[position++];
+        return true;
+    }
+
+    return false;
+}
+
+
+const std::string& SuggestionRange::current() const noexcept
+{
+    return suggestion;
+}
+
+
+SuggestionTechnique SuggestionRange::technique() const noexcept
+{
+    return suggestionTechnique;
+}
+
+
+SuggestionRange::iterator SuggestionRange::begin()
+{
+    return iterator{next() ? this : nullptr};
+}
+
+
+SuggestionRange::iterator SuggestionRange::end() noexcept
+{
+    return iterator{nullptr};
+}
+
+
+SuggestionRange::iterator& SuggestionRange::iterator::operator++()
+{
+    if(!range->next()){
+        range = nullptr;
+    }
+    return *this;
+}
+
+
+std::vector<std::string> WordChecker::generateSuggestions(const std::string& word, SuggestionOrder order) const
+{
+    SuggestionCollector collector;
+    forEachSuggestion(word, [&](const std::string& suggestion, SuggestionTechnique)
+    {
+        collector.add(suggestion);
+    }, UnlimitedBudget{});
+
+    return collector.suggestions(order);
+}
+
+
+void WordChecker::useDeletionIndex(const DeletionIndex& index)
+{
+    deletionIndex = &index;
+}
+
+
+std::vector<std::string> WordChecker::findSuggestions(const std::string& word, SuggestionDepth depth) const
+{
+    if(depth == SuggestionDepth::OneEdit){
+        return findSuggestions(word);
+    }
+
+    // Undoing an edit leads straight back to the word, which is only a
+    // suggestion if the first round suggested it.
+    SuggestionCollector collector;
+    bool keepWord = true;
+    auto insert = [&](const std::string& suggestion, SuggestionTechnique)
+    {
+        if(keepWord || suggestion != word){
+            collector.add(suggestion);
+        }
+    };
+
+    withAlphabet(alphabet, [&](auto tag)
+    {
+        using Alphabet = typename decltype(tag)::Alphabet;
+
+        forEachSuggestionIn<Alphabet>(word, insert, UnlimitedBudget{});
+        if(deletionIndex == nullptr && trie == nullptr){
+            return;
+        }
+
+        keepWord = collector.contains(word);
+        forEachSecondEditSuggestion<Alphabet>(word, insert);
+    });
+
+    return collector.suggestions(SuggestionOrder::Sorted);
+}
+
+
+template <typename Alphabet, typename Visit>
+void WordChecker::forEachSecondEditSuggestion(const std::string& word, Visit visit) const
+{
+    // The intermediates, the strings one edit from the word, are made one
+    // at a time and mostly aren't words.  Only those that some word is one
+    // edit away from are worth expanding with every technique: the
+    // DeletionIndex rules most of them out with a few hash lookups, and
+    // the trie walk abandons each candidate at its first dead prefix, so
+    // the full second round of candidates is never built.  Splits aren't
+    // edits, so every intermediate is still tried as a split, which costs
+    // little more than one lookup per position.
+    std::unordered_set<std::string> expanded{word};
+
+    auto exists = [this](const std::string& candidate)
+    {
+        return wordExists(candidate);
+    };
+
+    UnlimitedBudget unlimited;
+    forEachCharacterEdit<Alphabet>(word, [&](const std::string& intermediate, SuggestionTechnique)
+    {
+        if(!expanded.insert(intermediate).second){
+            return;
+        }
+
+        // The DeletionIndex works on bytes, so it can only rule out an
+        // intermediate when it, and every letter that might be put into
+        // it, are all single bytes.
+        if(deletionIndex == nullptr || !alphabetIsAscii<Alphabet>() || !isAsciiWord(intermediate)
+            || deletionIndex->mightHaveNeighbours(intermediate)){
+            forEachSuggestionIn<Alphabet>(intermediate, visit, unlimited);
+        }
+        else{
+            forEachSplit(intermediate, exists, visit, unlimited);
+        }
+    }, unlimited);
+}
+
+
+void WordChecker::useWordFrequencies(const WordFrequencies& frequencies)
+{
+    this->frequencies = &frequencies;
+}
+
+
+std::vector<std::string> WordChecker::findSuggestions(const std::string& word, unsigned int k) const
+{
+    struct Ranked
+    {
+        std::string suggestion;
+        unsigned long long frequency;
+        SuggestionTechnique technique;
+    };
+
+    // better() is the ranking order.  The heap keeps the worst of the best
+    // k at its front, so each new suggestion only has to beat that one.
+    auto better = [](const Ranked& a, const Ranked& b)
+    {
+        if(a.frequency != b.frequency){
+            return a.frequency > b.frequency;
+        }
+        if(a.technique != b.technique){
+            return a.technique < b.technique;
+        }
+        return a.suggestion < b.suggestion;
+    };
+
+    std::vector<Ranked> heap;
+    if(k == 0){
+        return {};
+    }
+    heap.reserve(k + 1);
+
+    forEachSuggestion(word, [&](const std::string& suggestion, SuggestionTechnique technique)
+    {
+        Ranked candidate{std::string{}, frequencyOf(suggestion), technique};
+
+        if(heap.size() == k){
+            const Ranked& worst = heap.front();
+            if(candidate.frequency < worst.frequency
+                || (candidate.frequency == worst.frequency && candidate.technique > worst.technique)){
+                return;
+            }
+        }
+
+        // The techniques run in ranking order, so a suggestion found a
+        // second time never ranks better than it did the first time; it
+        // only needs to be kept out of the heap if it's still there.
+        for(const Ranked& kept : heap){
+            if(kept.suggestion == suggestion){
+                return;
+            }
+        }
+
+        candidate.suggestion = suggestion;
+        if(heap.size() == k){
+            if(!better(candidate, heap.front())){
+                return;
+            }
+            std::pop_heap(heap.begin(), heap.end(), better);
+            heap.pop_back();
+        }
+        heap.push_back(std::move(candidate));
+        std::push_heap(heap.begin(), heap.end(), better);
+    }, UnlimitedBudget{});
+
+    std::sort_heap(heap.begin(), heap.end(), better);
+
+    std::vector<std::string> result;
+    result.reserve(heap.size());
+    for(Ranked& ranked : heap){
+        result.push_back(std::move(ranked.suggestion));
     }
     return result;
 }
 
+
+unsigned long long WordChecker::frequencyOf(const std::string& suggestion) const
+{
+    if(frequencies == nullptr){
+        return 0;
+    }
+
+    std::size_t space = suggestion.find(' ');
+    if(space == std::string::npos){
+        return frequencies->frequency(suggestion);
+    }
+
+    // A split can have any number of words, and is as frequent as its rarest.
+    unsigned long long rarest = frequencies->frequency(suggestion.substr(0, space));
+    while(space != std::string::npos && rarest > 0){
+        std::size_t start = space + 1;
+        space = suggestion.find(' ', start);
+        rarest = std::min(rarest, frequencies->frequency(suggestion.substr(start, space - start)));
+    }
+    return rarest;
+}
+
+
+std::vector<std::vector<std::string>> WordChecker::findSuggestions(
+    const std::vector<std::string>& words, unsigned int threadCount) const
+{
+    std::vector<std::vector<std::string>> results(words.size());
+
+    if(threadCount == 0){
+        threadCount = std::thread::hardware_concurrency();
+        if(threadCount == 0){
+            threadCount = 1;
+        }
+    }
+    if(threadCount > words.size()){
+        threadCount = words.size();
+    }
+
+    // Each worker claims the next unprocessed word from a shared counter, so
+    // a few expensive words don't leave the other workers sitting idle the
+    // way a fixed partitioning of the batch would.  Every result slot is
+    // written by exactly one worker, so no further locking is needed.
+    //
+    // An exception can't be allowed to escape a worker's thread, so the
+    // first one thrown is kept, every worker stops claiming words, and it's
+    // rethrown here once they've all been joined.
+    std::atomic<std::size_t> next{0};
+    std::mutex failureMutex;
+    std::exception_ptr failure;
+    auto worker = [&]()
+    {
+        try{
+            for(std::size_t i = next++; i < words.size(); i = next++){
+                results[i] = findSuggestions(words[i]);
+            }
+        }
+        catch(...){
+            std::lock_guard<std::mutex> lock{failureMutex};
+            if(!failure){
+                failure = std::current_exception();
+            }
+            next = words.size();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    try{
+        for(unsigned int t = 1; t < threadCount; t++){
+            pool.emplace_back(worker);
+        }
+    }
+    catch(...){
+        // If a thread can't be started, the ones that were finish the batch.
+    }
+    worker();
+    for(std::thread& thread : pool){
+        thread.join();
+    }
+
+    if(failure){
+        std::rethrow_exception(failure);
+    }
+
+    return results;
+}
+
+
+void WordChecker::useBKTree(const BKTree& tree)
+{
+    bkTree = &tree;
+}
+
+
+void WordChecker::useSortedWords(const std::vector<std::string>& sortedWords)
+{
+    this->sortedWords = &sortedWords;
+}
+
+
+std::vector<std::string> WordChecker::findWordsWithinDistance(
+    const std::string& word, unsigned int maxDistance) const
+{
+    if(trie != nullptr){
+        return LevenshteinAutomaton{word, maxDistance}.intersect(*trie);
+    }
+    else if(sortedWords != nullptr){
+        return LevenshteinAutomaton{word, maxDistance}.intersect(*sortedWords);
+    }
+    else if(bkTree != nullptr){
+        return bkTree->findWithinDistance(word, maxDistance);
+    }
+
+    return {};
+}
+
+
+void WordChecker::usePhoneticIndex(const PhoneticIndex& index)
+{
+    phoneticIndex = &index;
+}
+
+
+std::vector<std::string> WordChecker::findSoundAlikes(const std::string& word) const
+{
+    if(phoneticIndex == nullptr){
+        return {};
+    }
+
+    return phoneticIndex->findSoundAlikes(word);
+}
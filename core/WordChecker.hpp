@@ -16,10 +16,186 @@
 #ifndef WORDCHECKER_HPP
 #define WORDCHECKER_HPP
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_set>
 #include <vector>
 #include "Set.hpp"
 #include <set>
+#include "BKTree.hpp"
+#include "DeletionIndex.hpp"
+#include "BloomFilter.hpp"
+#include "LRUCache.hpp"
+#include "WordFrequencies.hpp"
+#include "LevenshteinAutomaton.hpp"
+#include "TrieSet.hpp"
+#include "PhoneticIndex.hpp"
+#include "Alphabet.hpp"
+#include "SuggestionCollector.hpp"
+#include "SuggestionTechniques.hpp"
+
+
+
+// BloomFilterStats counts what happened to the lookups made while a
+// BloomFilter was in front of the Set: how many the filter rejected
+// outright, how many it passed on to the Set, and how many of those the
+// Set then didn't contain after all.
+struct BloomFilterStats
+{
+    unsigned long long rejected;
+    unsigned long long passed;
+    unsigned long long falsePositives;
+};
+
+
+
+// SuggestionAlphabet selects which of the alphabets in Alphabet.hpp
+// findSuggestions() inserts and replaces characters from.  Uppercase is
+// the project write-up's 'A' through 'Z'; German and French are
+// lowercase, with their accented letters (and, for French, an
+// apostrophe).
+enum class SuggestionAlphabet
+{
+    Uppercase,
+    Lowercase,
+    LowercaseApostrophe,
+    MixedCase,
+    MixedCaseApostrophe,
+    Alphanumeric,
+    German,
+    French
+};
+
+
+
+// SuggestionBudget limits how much work the budgeted form of
+// findSuggestions() may do for one word: at most maxLookups lookups (0
+// meaning no limit), and none after the deadline.  For example, to give up
+// after two milliseconds:
+//
+//     SuggestionBudget budget;
+//     budget.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds{2};
+struct SuggestionBudget
+{
+    unsigned long long maxLookups = 0;
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+};
+
+
+
+// PartialSuggestions are the suggestions found within a SuggestionBudget,
+// with partial set if the budget ran out before every technique had been
+// tried at every position.
+struct PartialSuggestions
+{
+    std::vector<std::string> suggestions;
+    bool partial;
+};
+
+
+
+// SuggestionDepth says how many edits away from a word findSuggestions()
+// looks for suggestions: OneEdit applies each technique once, as in the
+// project write-up, while TwoEdits also applies the techniques again to
+// each string the first round made.
+enum class SuggestionDepth
+{
+    OneEdit,
+    TwoEdits
+};
+
+
+
+class WordChecker;
+
+
+
+// SuggestionRange produces the suggestions for one word lazily: each call
+// to next() makes and looks up candidates only until it finds the next
+// suggestion, so a caller who wants just the first one (or the first few)
+// never pays for the rest.  The splits are the one exception: they come
+// from a single dynamic program over the whole word, which does all of its
+// O(n^2) lookups before the first split can come out, so asking for one
+// split costs as much as asking for all of them.  Suggestions come out in
+// the order the techniques run (swaps, insertions, deletions, replacements,
+// splits), not sorted, and each only once.  It can also be used in a
+// range-based for loop, which continues from wherever next() left off:
+//
+//     for (const std::string& suggestion : checker.lazySuggestions(word))
+//
+// A SuggestionRange refers to its WordChecker, which must outlive it.
+class SuggestionRange
+{
+public:
+    class iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::string;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string*;
+        using reference = const std::string&;
+
+        reference operator*() const noexcept { return range->current(); }
+        pointer operator->() const noexcept { return &range->current(); }
+        iterator& operator++();
+        void operator++(int) { ++*this; }
+
+        bool operator==(const iterator& other) const noexcept { return range == other.range; }
+        bool operator!=(const iterator& other) const noexcept { return range != other.range; }
+
+    private:
+        friend class SuggestionRange;
+        explicit iterator(SuggestionRange* range) noexcept : range{range} { }
+
+        SuggestionRange* range;
+    };
+
+
+    // next() moves on to the next suggestion, returning false once there
+    // are no more.
+    bool next();
+
+    // current() returns the suggestion next() last moved to, and
+    // technique() returns the technique that produced it.
+    const std::string& current() const noexcept;
+    SuggestionTechnique technique() const noexcept;
+
+    iterator begin();
+    iterator end() noexcept;
+
+private:
+    friend class WordChecker;
+    SuggestionRange(const WordChecker& checker, const std::string& word,
+                    const std::string_view* letters, std::size_t letterCount);
+
+    bool makeCandidate();
+
+    const WordChecker* checker;
+    std::string word;
+    std::vector<std::size_t> starts;
+    const std::string_view* letters;
+    std::size_t letterCount;
+
+    // stage, position and letter are the technique, character (or, for
+    // splits, index into splits) and alphabet letter the next candidate is
+    // made from.
+    SuggestionTechnique stage;
+    std::size_t position;
+    std::size_t letter;
+    bool finished;
+
+    std::string candidate;
+    std::vector<std::string> splits;
+    std::string suggestion;
+    SuggestionTechnique suggestionTechnique;
+    std::unordered_set<std::string> seen;
+};
 
 
 
@@ -37,14 +213,214 @@ public:
     bool wordExists(const std::string& word) const;
 
 
+    // useBloomFilter() puts a BloomFilter, which must hold every word in the
+    // Set, in front of it: wordExists() (and so findSuggestions(), which
+    // mostly generates non-words) only calls the Set's contains() when the
+    // filter says a word might be present.  The WordChecker stores a
+    // reference to the filter, so it must outlive the WordChecker.  If
+    // countLookups is true, every lookup is also counted for
+    // bloomFilterStats().
+    void useBloomFilter(const BloomFilter& filter, bool countLookups = false);
+
+
+    // bloomFilterStats() returns the counts of lookups the BloomFilter has
+    // rejected and passed since it was given to useBloomFilter() or the
+    // counts were last reset; resetBloomFilterStats() sets them to zero.
+    // These are useful for choosing the filter's size and false positive
+    // rate.  The counts are only kept when useBloomFilter() was asked to
+    // count lookups, since counting costs an atomic increment per lookup,
+    // shared by every thread running a batch of findSuggestions() calls;
+    // otherwise they stay zero.
+    BloomFilterStats bloomFilterStats() const noexcept;
+    void resetBloomFilterStats() noexcept;
+
+
     // findSuggestions() returns a vector containing suggested alternative
     // spellings for the given word, using the five algorithms described in
-    // the project write-up.
+    // the project write-up.  Words are treated as UTF-8, so the techniques
+    // swap, insert, delete and replace whole characters; words that are
+    // all ASCII, with an ASCII alphabet, take a faster path that edits
+    // single bytes in place.  On that path, when the Set is a TrieSet, the
+    // candidates are built by walking the trie, so that a candidate is
+    // abandoned as soon as its prefix begins no word, and only the letters
+    // that can actually follow a prefix are inserted or replaced; the
+    // results are the same.
     std::vector<std::string> findSuggestions(const std::string& word) const;
 
 
+    // findSuggestions() can also be told not to sort the suggestions, in
+    // which case they're returned in the order they were found: the swaps
+    // first, then the insertions, and so on.  That saves sorting them when
+    // the caller doesn't care about their order.
+    std::vector<std::string> findSuggestions(const std::string& word, SuggestionOrder order) const;
+
+
+    // findSuggestions() can also be given a SuggestionBudget, in which case
+    // it stops looking as soon as the budget runs out and returns what it
+    // has found so far, sorted, along with whether that's all of them.  The
+    // techniques run in the usual order, so a partial result holds the
+    // swaps, then the insertions, and so on.  Only complete results are
+    // cached, but a cached result is returned without spending anything.
+    PartialSuggestions findSuggestions(const std::string& word, const SuggestionBudget& budget) const;
+
+
+    // lazySuggestions() returns a SuggestionRange that finds the same
+    // suggestions as findSuggestions(), one at a time, only as they're
+    // asked for.  It edits whole characters on every path, looking each
+    // candidate up with wordExists(); it doesn't walk a TrieSet or use the
+    // suggestion cache.
+    SuggestionRange lazySuggestions(const std::string& word) const;
+
+
+    // useAlphabet() sets the alphabet findSuggestions() inserts and replaces
+    // characters from, which is Uppercase unless this is called.  It should
+    // match the dictionary's words: a narrower alphabet means fewer
+    // lookups per suggestion, while a missing letter means missing
+    // suggestions.  Changing it empties the suggestion cache.
+    void useAlphabet(SuggestionAlphabet alphabet);
+
+
+    // useDeletionIndex() gives the WordChecker a DeletionIndex built from
+    // the same words as its Set, which the TwoEdits form of
+    // findSuggestions() uses to decide which strings are worth editing a
+    // second time.  As with the other indexes, the WordChecker stores a
+    // reference to it.
+    void useDeletionIndex(const DeletionIndex& index);
+
+
+    // findSuggestions() can also be asked for suggestions up to two edits
+    // away.  The second round of edits is far too large to generate in
+    // full, so it's only done when it can be pruned: when the Set is a
+    // TrieSet, or a DeletionIndex has been given to useDeletionIndex().
+    // Otherwise, TwoEdits gives the same suggestions as OneEdit.  These
+    // suggestions aren't cached.
+    std::vector<std::string> findSuggestions(const std::string& word, SuggestionDepth depth) const;
+
+
+    // useWordFrequencies() gives the WordChecker a frequency for each of its
+    // words, which the ranked form of findSuggestions() uses.  As with the
+    // other indexes, the WordChecker stores a reference to it.
+    void useWordFrequencies(const WordFrequencies& frequencies);
+
+
+    // findSuggestions() can also be asked for only the best k suggestions,
+    // which it returns best first.  Suggestions are ranked by frequency
+    // (most frequent first; a split's frequency is that of its rarest word,
+    // and every frequency is 0 if none were given to useWordFrequencies()),
+    // then by the technique that produced them, then alphabetically.  Only
+    // the best k are ever kept while the suggestions are being generated,
+    // so asking for a few is cheaper than finding them all and sorting.
+    std::vector<std::string> findSuggestions(const std::string& word, unsigned int k) const;
+
+
+    // enableSuggestionCache() makes findSuggestions() remember the
+    // suggestions for up to capacity recently seen words, so repeated
+    // misspellings are answered without regenerating them.  Calling it
+    // again replaces the cache with an empty one of the new capacity, and
+    // a capacity of 0 turns caching off.  The cache is safe to use from
+    // several threads at once.
+    void enableSuggestionCache(unsigned int capacity);
+
+
+    // invalidateSuggestionCache() empties the suggestion cache.  It must be
+    // called whenever words are added to the Set (or to a TrieSet), since
+    // cached suggestions may no longer be complete.
+    void invalidateSuggestionCache();
+
+
+    // suggestionCacheStats() returns the suggestion cache's hit, miss and
+    // eviction counts, along with its size and capacity; all are zero if
+    // caching isn't enabled.
+    LRUCacheStats suggestionCacheStats() const;
+
+
+    // findSuggestions() can also be given a whole batch of misspelled words,
+    // in which case it returns one vector of suggestions per word, in the
+    // same order as the words were given.  The work is spread across a pool
+    // of threadCount worker threads; a threadCount of 0 means to use one
+    // thread per available hardware core.  The underlying Set is only ever
+    // read, so it must not be modified while the batch is running.
+    std::vector<std::vector<std::string>> findSuggestions(
+        const std::vector<std::string>& words, unsigned int threadCount = 0) const;
+
+
+    // useBKTree() gives the WordChecker a BKTree built from the same words
+    // as its Set, which findWordsWithinDistance() uses to answer queries.
+    // The WordChecker stores a reference to it, so it must outlive the
+    // WordChecker (or at least its last call to findWordsWithinDistance()).
+    void useBKTree(const BKTree& tree);
+
+
+    // useSortedWords() gives the WordChecker the same words as its Set, in
+    // sorted order (for example, as collected by AVLSet::inorder()), which
+    // findWordsWithinDistance() can search with a LevenshteinAutomaton.
+    // As with useBKTree(), the vector must outlive its use.
+    void useSortedWords(const std::vector<std::string>& sortedWords);
+
+
+    // findWordsWithinDistance() returns, in sorted order, every word whose
+    // Levenshtein distance from the given word is at most maxDistance.
+    // Unlike findSuggestions(), this reaches beyond a single edit, so it
+    // needs something it can search: when the Set is a TrieSet, or sorted
+    // words have been given to useSortedWords(), a LevenshteinAutomaton is
+    // intersected with them, so no candidate strings are generated at all;
+    // otherwise, a BKTree given to useBKTree() is searched.  With none of
+    // these, it returns an empty vector.
+    std::vector<std::string> findWordsWithinDistance(
+        const std::string& word, unsigned int maxDistance) const;
+
+
+    // usePhoneticIndex() gives the WordChecker a PhoneticIndex built from
+    // the same words as its Set, which findSoundAlikes() uses.  As with the
+    // other indexes, the WordChecker stores a reference to it.
+    void usePhoneticIndex(const PhoneticIndex& index);
+
+
+    // findSoundAlikes() returns, in sorted order, the words that sound like
+    // the given one (those with the same Metaphone key), however many edits
+    // away from it they are.  It takes a single hash lookup in the
+    // PhoneticIndex given to usePhoneticIndex(); without one, it returns an
+    // empty vector.
+    std::vector<std::string> findSoundAlikes(const std::string& word) const;
+
+
 private:
+    std::vector<std::string> generateSuggestions(const std::string& word, SuggestionOrder order) const;
+
+    // forEachSuggestion() calls visit(suggestion, technique) for every
+    // suggestion each technique finds, in the order the techniques run,
+    // as described in SuggestionTechniques.hpp.
+    template <typename Visit, typename Budget>
+    void forEachSuggestion(const std::string& word, Visit visit, Budget&& budget) const;
+
+    template <typename Alphabet, typename Visit, typename Budget>
+    void forEachSuggestionIn(const std::string& word, Visit visit, Budget&& budget) const;
+
+    template <typename Alphabet, typename Visit>
+    void forEachSecondEditSuggestion(const std::string& word, Visit visit) const;
+
+    template <typename Alphabet, typename Visit, typename Budget>
+    void forEachSuggestionInTrie(const std::string& word, Visit visit, Budget&& budget) const;
+
+    unsigned long long frequencyOf(const std::string& suggestion) const;
+
     const Set<std::string>& words;
+    const TrieSet* trie;
+    const BKTree* bkTree;
+    const std::vector<std::string>* sortedWords;
+    const WordFrequencies* frequencies;
+    const DeletionIndex* deletionIndex;
+    const PhoneticIndex* phoneticIndex;
+
+    const BloomFilter* bloomFilter;
+    bool countBloomLookups;
+    mutable std::atomic<unsigned long long> bloomRejected;
+    mutable std::atomic<unsigned long long> bloomPassed;
+    mutable std::atomic<unsigned long long> bloomFalsePositives;
+
+    std::unique_ptr<LRUCache<std::string, std::vector<std::string>>> suggestionCache;
+
+    SuggestionAlphabet alphabet;
 };
 
 
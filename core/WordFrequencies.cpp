@@ -0,0 +1,49 @@
+// WordFrequencies.cpp
+
+#include "WordFrequencies.hpp"
+#include <sstream>
+
+
+
+WordFrequencies::WordFrequencies()
+{
+}
+
+
+void WordFrequencies::set(const std::string& word, unsigned long long frequency)
+{
+    frequencies[word] = frequency;
+}
+
+
+unsigned int WordFrequencies::load(std::istream& in)
+{
+    unsigned int count = 0;
+    std::string line;
+
+    while(std::getline(in, line)){
+        std::istringstream fields{line};
+        std::string word;
+        unsigned long long frequency;
+
+        if(fields >> word >> frequency){
+            set(word, frequency);
+            count++;
+        }
+    }
+
+    return count;
+}
+
+
+unsigned long long WordFrequencies::frequency(const std::string& word) const
+{
+    auto found = frequencies.find(word);
+    return found == frequencies.end() ? 0 : found->second;
+}
+
+
+unsigned int WordFrequencies::size() const noexcept
+{
+    return frequencies.size();
+}
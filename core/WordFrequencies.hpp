@@ -0,0 +1,50 @@
+// WordFrequencies.hpp
+//
+// WordFrequencies associates a frequency (for example, how many times each
+// word appeared in a large corpus) with the words of a dictionary, so that
+// WordChecker can rank its suggestions by how likely each one is.  Words
+// that have no frequency recorded have a frequency of 0.
+
+#ifndef WORDFREQUENCIES_HPP
+#define WORDFREQUENCIES_HPP
+
+#include <istream>
+#include <string>
+#include <unordered_map>
+
+
+
+class WordFrequencies
+{
+public:
+    // Initializes an empty WordFrequencies.
+    WordFrequencies();
+
+
+    // set() records the frequency of the given word, replacing any
+    // frequency already recorded for it.
+    void set(const std::string& word, unsigned long long frequency);
+
+
+    // load() reads lines of the form "WORD FREQUENCY" from the given stream
+    // until it ends, recording each one with set().  Lines that don't have
+    // that form are skipped.  It returns the number of lines recorded.
+    unsigned int load(std::istream& in);
+
+
+    // frequency() returns the frequency recorded for the given word, or 0
+    // if there isn't one.
+    unsigned long long frequency(const std::string& word) const;
+
+
+    // size() returns the number of words with a recorded frequency.
+    unsigned int size() const noexcept;
+
+
+private:
+    std::unordered_map<std::string, unsigned long long> frequencies;
+};
+
+
+
+#endif
@@ -0,0 +1,135 @@
+// WorkStealingPool.cpp
+
+#include "WorkStealingPool.hpp"
+#include <atomic>
+#include <exception>
+#include <thread>
+
+
+
+WorkStealingPool::WorkStealingPool(unsigned int threadCount)
+    : threads{threadCount}, stolen{0}
+{
+    if(threads == 0){
+        threads = std::thread::hardware_concurrency();
+        if(threads == 0){
+            threads = 1;
+        }
+    }
+}
+
+
+void WorkStealingPool::run(unsigned int taskCount, const TaskFunction& task)
+{
+    unsigned int workers = threads < taskCount ? threads : taskCount;
+    stolen = 0;
+    if(workers == 0){
+        return;
+    }
+
+    // Tasks are dealt round-robin, and each worker works through its own
+    // in ascending order from the back of its queue, so the workers
+    // together finish tasks in roughly ascending order; a caller that
+    // consumes results in task order (as CorpusChecker does) can consume
+    // most of them while the rest are still running.  Thieves take the
+    // highest-numbered tasks from the front, the ones needed last.
+    queues.clear();
+    for(unsigned int w = 0; w < workers; w++){
+        queues.push_back(std::make_unique<Queue>());
+    }
+    for(unsigned int t = 0; t < taskCount; t++){
+        queues[t % workers]->tasks.push_front(t);
+    }
+
+    std::atomic<unsigned int> stolenCount{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr failure;
+    std::mutex failureMutex;
+
+    auto work = [&](unsigned int worker)
+    {
+        unsigned int t;
+        while(!failed){
+            if(!takeOwn(worker, t)){
+                if(!steal(worker, t)){
+                    // No new tasks are ever added, so once every queue is
+                    // empty there is nothing left to do.
+                    return;
+                }
+                stolenCount++;
+            }
+
+            try{
+                task(t);
+            }
+            catch(...){
+                std::lock_guard<std::mutex> lock{failureMutex};
+                if(!failed.exchange(true)){
+                    failure = std::current_exception();
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for(unsigned int w = 1; w < workers; w++){
+        pool.emplace_back(work, w);
+    }
+    work(0);
+    for(std::thread& thread : pool){
+        thread.join();
+    }
+
+    stolen = stolenCount;
+    queues.clear();
+
+    if(failure){
+        std::rethrow_exception(failure);
+    }
+}
+
+
+unsigned int WorkStealingPool::threadCount() const noexcept
+{
+    return threads;
+}
+
+
+unsigned int WorkStealingPool::stolenTaskCount() const noexcept
+{
+    return stolen;
+}
+
+
+bool WorkStealingPool::takeOwn(unsigned int worker, unsigned int& task)
+{
+    Queue& queue = *queues[worker];
+    std::lock_guard<std::mutex> lock{queue.mutex};
+
+    if(queue.tasks.empty()){
+        return false;
+    }
+
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+    return true;
+}
+
+
+bool WorkStealingPool::steal(unsigned int worker, unsigned int& task)
+{
+    // Victims are tried starting just after this worker, so that stealing
+    // workers spread themselves over different victims.
+    for(unsigned int i = 1; i < queues.size(); i++){
+        Queue& victim = *queues[(worker + i) % queues.size()];
+        std::lock_guard<std::mutex> lock{victim.mutex};
+
+        if(!victim.tasks.empty()){
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
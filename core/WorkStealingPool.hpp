@@ -0,0 +1,71 @@
+// WorkStealingPool.hpp
+//
+// A WorkStealingPool runs a fixed set of numbered tasks on a group of
+// worker threads, balancing them by work stealing.  The tasks are dealt out
+// round-robin to the workers' own queues up front, so they're started in
+// roughly ascending order; each worker takes tasks from the back of its own
+// queue, and when that runs dry, steals from the front of another worker's
+// queue.  So when some tasks take far longer than others,
+// workers that finish early keep busy with the slow ones' leftovers instead
+// of sitting idle, as they would with a static partitioning.
+//
+// Each queue has its own lock, which is only ever contended when a worker
+// is stealing from it.
+
+#ifndef WORKSTEALINGPOOL_HPP
+#define WORKSTEALINGPOOL_HPP
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+
+class WorkStealingPool
+{
+public:
+    // A TaskFunction runs the task with the given number.
+    using TaskFunction = std::function<void(unsigned int task)>;
+
+public:
+    // Initializes a pool of threadCount workers.  A threadCount of 0 means
+    // to use one worker per available hardware core.
+    explicit WorkStealingPool(unsigned int threadCount = 0);
+
+
+    // run() runs the tasks numbered 0 through taskCount - 1, returning once
+    // all of them have finished.  The calling thread is one of the workers.
+    // If a task throws an exception, the remaining tasks are abandoned and
+    // the first exception is rethrown from run().
+    void run(unsigned int taskCount, const TaskFunction& task);
+
+
+    // threadCount() returns the number of workers in the pool.
+    unsigned int threadCount() const noexcept;
+
+
+    // stolenTaskCount() returns how many tasks were stolen during the last
+    // call to run().
+    unsigned int stolenTaskCount() const noexcept;
+
+
+private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<unsigned int> tasks;
+    };
+
+    bool takeOwn(unsigned int worker, unsigned int& task);
+    bool steal(unsigned int worker, unsigned int& task);
+
+    unsigned int threads;
+    unsigned int stolen;
+    std::vector<std::unique_ptr<Queue>> queues;
+};
+
+
+
+#endif
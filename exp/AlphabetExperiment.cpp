@@ -0,0 +1,110 @@
+// AlphabetExperiment.cpp
+//
+// Lowercases the dictionary (and gives one word in ten an apostrophe),
+// then measures findSuggestions() with each alphabet: the number of Set
+// lookups it makes per query, the number of suggestions it finds, and its
+// latency.  The uppercase alphabet wastes every insert and replace lookup
+// on such a dictionary; the wider ones pay for letters that never appear,
+// and German also pays for editing whole UTF-8 characters instead of bytes.
+
+#include <cctype>
+#include <chrono>
+#include <iostream>
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "HashSet.hpp"
+#include "WordChecker.hpp"
+
+
+
+namespace
+{
+    // CountingSet counts the lookups made through it.
+    class CountingSet : public Set<std::string>
+    {
+    public:
+        explicit CountingSet(const Set<std::string>& words)
+            : words{words}, lookups{0}
+        {
+        }
+
+        bool isImplemented() const noexcept override { return true; }
+        void add(const std::string&) override { }
+        bool contains(const std::string& element) const override { lookups++; return words.contains(element); }
+        unsigned int size() const noexcept override { return words.size(); }
+
+        const Set<std::string>& words;
+        mutable unsigned long long lookups;
+    };
+
+
+    std::string lowercase(std::string s)
+    {
+        for (char& c : s)
+        {
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+
+        return s;
+    }
+}
+
+
+void runAlphabetExperiment(const std::vector<std::string>& words)
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::vector<std::string> lowercaseWords;
+    HashSet<std::string> set{experimentHash};
+    for (unsigned int i = 0; i < words.size(); ++i)
+    {
+        std::string word = lowercase(words[i]);
+        if (i % 10 == 0 && word.size() >= 2)
+        {
+            word.insert(word.size() - 1, 1, '\'');
+        }
+        set.add(word);
+        lowercaseWords.push_back(word);
+    }
+
+    std::vector<std::string> queries;
+    for (unsigned int i = 0; i < 2000 && i < lowercaseWords.size(); ++i)
+    {
+        queries.push_back(lowercase(misspell(lowercaseWords[(i * 7919) % lowercaseWords.size()], i)));
+    }
+
+    struct Choice
+    {
+        const char* name;
+        SuggestionAlphabet alphabet;
+    };
+
+    const Choice choices[] =
+    {
+        {"Uppercase:           ", SuggestionAlphabet::Uppercase},
+        {"Lowercase:           ", SuggestionAlphabet::Lowercase},
+        {"LowercaseApostrophe: ", SuggestionAlphabet::LowercaseApostrophe},
+        {"MixedCaseApostrophe: ", SuggestionAlphabet::MixedCaseApostrophe},
+        {"Alphanumeric:        ", SuggestionAlphabet::Alphanumeric},
+        {"German:              ", SuggestionAlphabet::German},
+    };
+
+    for (const Choice& choice : choices)
+    {
+        CountingSet counting{set};
+        WordChecker checker{counting};
+        checker.useAlphabet(choice.alphabet);
+
+        unsigned long long suggestions = 0;
+        Clock::time_point start = Clock::now();
+        for (const std::string& query : queries)
+        {
+            suggestions += checker.findSuggestions(query).size();
+        }
+        double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+        std::cout << choice.name << static_cast<double>(counting.lookups) / queries.size() << " lookups/query, "
+                  << static_cast<double>(suggestions) / queries.size() << " suggestions/query, "
+                  << micros / queries.size() << " us/query" << std::endl;
+    }
+}
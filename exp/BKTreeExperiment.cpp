@@ -0,0 +1,68 @@
+// BKTreeExperiment.cpp
+//
+// Measures BKTree query latency at edit distances 1 to 3, along with the
+// fraction of the dictionary each query actually compared itself against,
+// and compares it to an exhaustive scan of every word.
+
+#include <chrono>
+#include <iostream>
+#include "BKTree.hpp"
+#include "EditDistance.hpp"
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+
+
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double elapsedMicroseconds(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    }
+}
+
+
+void runBKTreeExperiment(const std::vector<std::string>& words)
+{
+    Clock::time_point start = Clock::now();
+    BKTree tree;
+    for (const std::string& word : words)
+    {
+        tree.add(word);
+    }
+    std::cout << "Built a BKTree of " << tree.size() << " words in "
+              << elapsedMicroseconds(start) / 1000000.0 << " s" << std::endl;
+
+    std::vector<std::string> queries;
+    for (unsigned int i = 0; i < 200 && i < words.size(); ++i)
+    {
+        queries.push_back(misspell(words[i * 13 % words.size()], i));
+    }
+
+    start = Clock::now();
+    std::size_t found = 0;
+    for (const std::string& query : queries)
+    {
+        for (const std::string& word : words)
+        {
+            found += levenshteinDistance(query, word) <= 2 ? 1 : 0;
+        }
+    }
+    std::cout << "Exhaustive scan (k = 2): " << elapsedMicroseconds(start) / queries.size()
+              << " us/query, " << found << " words" << std::endl;
+
+    for (unsigned int k = 1; k <= 3; ++k)
+    {
+        start = Clock::now();
+        found = 0;
+        for (const std::string& query : queries)
+        {
+            found += tree.findWithinDistance(query, k).size();
+        }
+        std::cout << "BKTree (k = " << k << "):          "
+                  << elapsedMicroseconds(start) / queries.size()
+                  << " us/query, " << found << " words" << std::endl;
+    }
+}
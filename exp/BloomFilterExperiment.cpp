@@ -0,0 +1,96 @@
+// BloomFilterExperiment.cpp
+//
+// Measures WordChecker::findSuggestions() over each kind of Set with and
+// without a BloomFilter in front of it, at a few false positive rates,
+// and reports the filter's rejected/passed counts (counted in a separate,
+// untimed pass).
+
+#include <chrono>
+#include <iostream>
+#include "AVLSet.hpp"
+#include "BloomFilter.hpp"
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "HashSet.hpp"
+#include "SkipListSet.hpp"
+#include "WordChecker.hpp"
+
+
+
+namespace
+{
+    void measure(const char* name, const Set<std::string>& set,
+                 const std::vector<std::string>& words, const std::vector<std::string>& queries)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        for (double rate : {0.0, 0.1, 0.01, 0.001})
+        {
+            BloomFilter filter{static_cast<unsigned int>(words.size()), rate == 0.0 ? 0.5 : rate};
+            for (const std::string& word : words)
+            {
+                filter.add(word);
+            }
+
+            WordChecker checker{set};
+            if (rate != 0.0)
+            {
+                checker.useBloomFilter(filter);
+            }
+
+            Clock::time_point start = Clock::now();
+            for (const std::string& query : queries)
+            {
+                checker.findSuggestions(query);
+            }
+            double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+            std::cout << name;
+            if (rate == 0.0)
+            {
+                std::cout << " without filter:    ";
+            }
+            else
+            {
+                // Counting lookups slows them down, so the counts come
+                // from a second, untimed pass.
+                checker.useBloomFilter(filter, true);
+                for (const std::string& query : queries)
+                {
+                    checker.findSuggestions(query);
+                }
+
+                BloomFilterStats stats = checker.bloomFilterStats();
+                std::cout << " with p = " << rate << " (" << filter.bitCount() / 8192 << " KiB): "
+                          << "rejected " << stats.rejected << ", passed " << stats.passed
+                          << ", false positives " << stats.falsePositives << ", ";
+            }
+            std::cout << micros / queries.size() << " us/query" << std::endl;
+        }
+    }
+}
+
+
+void runBloomFilterExperiment(const std::vector<std::string>& words)
+{
+    HashSet<std::string> hashSet{experimentHash};
+    AVLSet<std::string> avlSet;
+    SkipListSet<std::string> skipListSet;
+
+    for (const std::string& word : words)
+    {
+        hashSet.add(word);
+        avlSet.add(word);
+        skipListSet.add(word);
+    }
+
+    std::vector<std::string> queries;
+    for (unsigned int i = 0; i < 2000 && i < words.size(); ++i)
+    {
+        queries.push_back(misspell(words[i * 7 % words.size()], i));
+    }
+
+    measure("HashSet", hashSet, words, queries);
+    measure("AVLSet", avlSet, words, queries);
+    measure("SkipListSet", skipListSet, words, queries);
+}
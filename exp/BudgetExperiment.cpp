@@ -0,0 +1,99 @@
+// BudgetExperiment.cpp
+//
+// Misspells the longest dictionary words, then measures findSuggestions()
+// with no budget against a few lookup and deadline budgets: mean and worst
+// latency per query, how often the result was partial, and how often the
+// original word was among the suggestions.
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "HashSet.hpp"
+#include "WordChecker.hpp"
+
+
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+
+    template <typename Find>
+    void measure(std::string name, const std::vector<std::string>& originals,
+                 const std::vector<std::string>& queries, Find find)
+    {
+        double totalMicros = 0.0;
+        double worstMicros = 0.0;
+        unsigned int partial = 0;
+        unsigned int found = 0;
+
+        for (std::size_t i = 0; i < queries.size(); ++i)
+        {
+            Clock::time_point start = Clock::now();
+            PartialSuggestions result = find(queries[i]);
+            double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+            totalMicros += micros;
+            worstMicros = std::max(worstMicros, micros);
+            partial += result.partial ? 1 : 0;
+            if (std::find(result.suggestions.begin(), result.suggestions.end(), originals[i])
+                != result.suggestions.end())
+            {
+                found++;
+            }
+        }
+
+        name.resize(20, ' ');
+        std::cout << name << totalMicros / queries.size() << " us/query mean, "
+                  << worstMicros << " us worst, " << partial << " of " << queries.size()
+                  << " partial, original found for " << found << std::endl;
+    }
+}
+
+
+void runBudgetExperiment(const std::vector<std::string>& words)
+{
+    HashSet<std::string> set{experimentHash};
+    for (const std::string& word : words)
+    {
+        set.add(word);
+    }
+
+    std::vector<std::string> originals;
+    std::vector<std::string> queries;
+    for (unsigned int i = 0; queries.size() < 1000 && i < words.size(); ++i)
+    {
+        const std::string& word = words[(i * 7919) % words.size()];
+        if (word.size() >= 10)
+        {
+            originals.push_back(word);
+            queries.push_back(misspell(word, i));
+        }
+    }
+
+    WordChecker checker{set};
+
+    measure("No budget:", originals, queries,
+            [&](const std::string& q) { return PartialSuggestions{checker.findSuggestions(q), false}; });
+
+    for (unsigned long long maxLookups : {800ULL, 400ULL, 200ULL})
+    {
+        SuggestionBudget budget;
+        budget.maxLookups = maxLookups;
+        measure(std::to_string(maxLookups) + " lookups:", originals, queries,
+                [&](const std::string& q) { return checker.findSuggestions(q, budget); });
+    }
+
+    for (long long micros : {20LL, 10LL, 5LL})
+    {
+        measure(std::to_string(micros) + " us deadline:", originals, queries,
+                [&](const std::string& q)
+                {
+                    SuggestionBudget budget;
+                    budget.deadline = Clock::now() + std::chrono::microseconds{micros};
+                    return checker.findSuggestions(q, budget);
+                });
+    }
+}
@@ -0,0 +1,69 @@
+// CorpusCheckerExperiment.cpp
+//
+// Writes a small corpus of generated documents (mostly dictionary words,
+// with one in fifty misspelled) to temporary files, then measures how fast
+// a CorpusChecker checks all of them, with suggestions, on increasing
+// numbers of threads.
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include "CorpusChecker.hpp"
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "HashSet.hpp"
+#include "WordChecker.hpp"
+
+
+
+void runCorpusCheckerExperiment(const std::vector<std::string>& words)
+{
+    using Clock = std::chrono::steady_clock;
+
+    HashSet<std::string> set{experimentHash};
+    for (const std::string& word : words)
+    {
+        set.add(word);
+    }
+
+    std::vector<std::string> paths;
+    double megabytes = 0.0;
+    for (unsigned int f = 0; f < 8; ++f)
+    {
+        std::filesystem::path path = std::filesystem::temp_directory_path()
+            / ("CorpusCheckerExperiment" + std::to_string(f) + ".txt");
+        {
+            std::ofstream out{path, std::ios::binary};
+            for (unsigned int i = 0; i < 4000000 / 8; ++i)
+            {
+                unsigned int n = f * 4000000 + i;
+                const std::string& word = words[(n * 2654435761u) % words.size()];
+                out << (n % 50 == 0 ? misspell(word, n) : word) << (i % 12 == 11 ? '\n' : ' ');
+            }
+        }
+        megabytes += std::filesystem::file_size(path) / 1048576.0;
+        paths.push_back(path.string());
+    }
+
+    WordChecker checker{set};
+
+    for (unsigned int threads : {1u, 2u, 4u, 8u})
+    {
+        CorpusChecker corpus{checker, threads, 256 * 1024};
+        unsigned long long misspellings = 0;
+
+        Clock::time_point start = Clock::now();
+        unsigned long long checked = corpus.checkFiles(paths,
+            [&](unsigned int, const Misspelling&) { misspellings++; });
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::cout << threads << " thread(s): " << checked << " words, " << misspellings
+                  << " misspelled, " << megabytes / seconds << " MB/s" << std::endl;
+    }
+
+    for (const std::string& path : paths)
+    {
+        std::filesystem::remove(path);
+    }
+}
@@ -0,0 +1,74 @@
+// DeletionIndexExperiment.cpp
+//
+// Compares the per-query latency of DeletionIndex::findSuggestions() with
+// WordChecker::findSuggestions() over a HashSet holding the same words,
+// along with what it costs to build the index.
+
+#include <chrono>
+#include <iostream>
+#include "DeletionIndex.hpp"
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "HashSet.hpp"
+#include "WordChecker.hpp"
+
+
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double elapsedMicroseconds(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    }
+}
+
+
+void runDeletionIndexExperiment(const std::vector<std::string>& words)
+{
+    HashSet<std::string> set{experimentHash};
+    for (const std::string& word : words)
+    {
+        set.add(word);
+    }
+
+    WordChecker checker{set};
+
+    std::vector<std::string> queries;
+    for (unsigned int i = 0; i < 5000 && i < words.size(); ++i)
+    {
+        queries.push_back(misspell(words[i * 7 % words.size()], i));
+    }
+
+    Clock::time_point start = Clock::now();
+    std::size_t found = 0;
+    for (const std::string& query : queries)
+    {
+        found += checker.findSuggestions(query).size();
+    }
+    std::cout << "WordChecker:           " << elapsedMicroseconds(start) / queries.size()
+              << " us/query, " << found << " suggestions" << std::endl;
+
+    for (unsigned int distance : {1u, 2u})
+    {
+        start = Clock::now();
+        DeletionIndex index{distance};
+        for (const std::string& word : words)
+        {
+            index.add(word);
+        }
+        double buildTime = elapsedMicroseconds(start) / 1000000.0;
+
+        start = Clock::now();
+        found = 0;
+        for (const std::string& query : queries)
+        {
+            found += index.findSuggestions(query).size();
+        }
+        std::cout << "DeletionIndex (d = " << distance << "): "
+                  << elapsedMicroseconds(start) / queries.size()
+                  << " us/query, " << found << " suggestions, built in "
+                  << buildTime << " s" << std::endl;
+    }
+}
@@ -0,0 +1,58 @@
+// DocumentCheckerExperiment.cpp
+//
+// Writes a large generated document (mostly dictionary words, with one in
+// fifty misspelled) to a temporary file, then measures how fast a
+// DocumentChecker memory-maps and checks it, with and without suggestions.
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include "DocumentChecker.hpp"
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "HashSet.hpp"
+#include "WordChecker.hpp"
+
+
+
+void runDocumentCheckerExperiment(const std::vector<std::string>& words)
+{
+    using Clock = std::chrono::steady_clock;
+
+    HashSet<std::string> set{experimentHash};
+    for (const std::string& word : words)
+    {
+        set.add(word);
+    }
+
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "DocumentCheckerExperiment.txt";
+    {
+        std::ofstream out{path, std::ios::binary};
+        for (unsigned int i = 0; i < 20000000 / 8; ++i)
+        {
+            const std::string& word = words[(i * 2654435761u) % words.size()];
+            out << (i % 50 == 0 ? misspell(word, i) : word) << (i % 12 == 11 ? '\n' : ' ');
+        }
+    }
+    double megabytes = std::filesystem::file_size(path) / 1048576.0;
+
+    WordChecker checker{set};
+
+    for (bool withSuggestions : {false, true})
+    {
+        DocumentChecker document{checker, withSuggestions};
+        unsigned long long misspellings = 0;
+
+        Clock::time_point start = Clock::now();
+        unsigned long long checked = document.checkFile(path.string(),
+            [&](const Misspelling&) { misspellings++; });
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::cout << (withSuggestions ? "With suggestions:    " : "Without suggestions: ")
+                  << checked << " words, " << misspellings << " misspelled, "
+                  << megabytes / seconds << " MB/s" << std::endl;
+    }
+
+    std::filesystem::remove(path);
+}
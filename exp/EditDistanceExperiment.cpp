@@ -0,0 +1,111 @@
+// EditDistanceExperiment.cpp
+//
+// Measures the time per pair to compute the distance from a query to each
+// of a sample of dictionary words, so that the pairs follow the
+// dictionary's own word lengths: the dynamic programming functions against
+// a BitParallelDistance, one word at a time and in batches.
+
+#include <chrono>
+#include <iostream>
+#include "EditDistance.hpp"
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+
+
+
+namespace
+{
+    template <typename Measure>
+    void measure(const char* name, const std::vector<std::string>& queries,
+                 const std::vector<std::string>& others, Measure distances)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        std::vector<unsigned int> results(others.size());
+        unsigned long long checksum = 0;
+
+        Clock::time_point start = Clock::now();
+        for (const std::string& query : queries)
+        {
+            distances(query, results);
+            for (unsigned int d : results)
+            {
+                checksum += d;
+            }
+        }
+        double nanos = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+        std::cout << name << nanos / (queries.size() * others.size()) << " ns/pair (checksum "
+                  << checksum << ")" << std::endl;
+    }
+}
+
+
+void runEditDistanceExperiment(const std::vector<std::string>& words)
+{
+    std::vector<std::string> queries;
+    std::vector<std::string> others;
+    std::vector<const std::string*> pointers;
+    for (unsigned int i = 0; i < 200 && i < words.size(); ++i)
+    {
+        queries.push_back(misspell(words[(i * 7919) % words.size()], i));
+    }
+    for (unsigned int i = 0; i < 5000 && i < words.size(); ++i)
+    {
+        others.push_back(words[(i * 104729) % words.size()]);
+    }
+    for (const std::string& other : others)
+    {
+        pointers.push_back(&other);
+    }
+
+    measure("levenshteinDistance():        ", queries, others,
+        [&](const std::string& q, std::vector<unsigned int>& results)
+        {
+            for (std::size_t i = 0; i < others.size(); ++i)
+            {
+                results[i] = levenshteinDistance(q, others[i]);
+            }
+        });
+
+    measure("BitParallelDistance, single:  ", queries, others,
+        [&](const std::string& q, std::vector<unsigned int>& results)
+        {
+            BitParallelDistance fromQuery{q};
+            for (std::size_t i = 0; i < others.size(); ++i)
+            {
+                results[i] = fromQuery.levenshtein(others[i]);
+            }
+        });
+
+    measure("BitParallelDistance, batched: ", queries, others,
+        [&](const std::string& q, std::vector<unsigned int>& results)
+        {
+            BitParallelDistance{q}.levenshtein(pointers.data(), pointers.size(), results.data());
+        });
+
+    measure("damerauDistance():            ", queries, others,
+        [&](const std::string& q, std::vector<unsigned int>& results)
+        {
+            for (std::size_t i = 0; i < others.size(); ++i)
+            {
+                results[i] = damerauDistance(q, others[i]);
+            }
+        });
+
+    measure("BitParallelDistance, single:  ", queries, others,
+        [&](const std::string& q, std::vector<unsigned int>& results)
+        {
+            BitParallelDistance fromQuery{q};
+            for (std::size_t i = 0; i < others.size(); ++i)
+            {
+                results[i] = fromQuery.damerau(others[i]);
+            }
+        });
+
+    measure("BitParallelDistance, batched: ", queries, others,
+        [&](const std::string& q, std::vector<unsigned int>& results)
+        {
+            BitParallelDistance{q}.damerau(pointers.data(), pointers.size(), results.data());
+        });
+}
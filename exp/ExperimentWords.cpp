@@ -0,0 +1,136 @@
+// ExperimentWords.cpp
+
+#include "ExperimentWords.hpp"
+#include <fstream>
+#include <random>
+#include <unordered_set>
+
+
+
+std::vector<std::string> loadExperimentWords(const std::string& path, unsigned int count)
+{
+    std::ifstream in{path};
+
+    if (path.empty() || !in)
+    {
+        return generateExperimentWords(count);
+    }
+
+    std::vector<std::string> words;
+    std::string line;
+
+    while (std::getline(in, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+
+        if (!line.empty())
+        {
+            words.push_back(line);
+        }
+    }
+
+    return words;
+}
+
+
+std::vector<std::string> generateExperimentWords(unsigned int count)
+{
+    std::mt19937 rng{46};
+    std::uniform_int_distribution<int> length{2, 12};
+    std::uniform_int_distribution<int> letter{'A', 'Z'};
+
+    std::unordered_set<std::string> seen;
+    std::vector<std::string> words;
+
+    while (words.size() < count)
+    {
+        std::string word(length(rng), ' ');
+
+        for (char& c : word)
+        {
+            c = static_cast<char>(letter(rng));
+        }
+
+        if (seen.insert(word).second)
+        {
+            words.push_back(word);
+        }
+    }
+
+    return words;
+}
+
+
+std::vector<std::string> topUpExperimentWords(const std::vector<std::string>& words, unsigned int count)
+{
+    std::vector<std::string> allWords = words;
+    std::unordered_set<std::string> seen{words.begin(), words.end()};
+
+    if (allWords.size() < count)
+    {
+        for (const std::string& word : generateExperimentWords(count))
+        {
+            if (allWords.size() < count && seen.insert(word).second)
+            {
+                allWords.push_back(word);
+            }
+        }
+    }
+
+    return allWords;
+}
+
+
+std::string misspell(const std::string& word, unsigned int seed)
+{
+    std::mt19937 rng{seed};
+    std::string result = word;
+    char letter = static_cast<char>('A' + rng() % 26);
+
+    switch (rng() % 4)
+    {
+    case 0:
+        if (result.size() >= 2)
+        {
+            unsigned int i = rng() % (result.size() - 1);
+            std::swap(result[i], result[i + 1]);
+        }
+        break;
+
+    case 1:
+        result.insert(rng() % (result.size() + 1), 1, letter);
+        break;
+
+    case 2:
+        if (!result.empty())
+        {
+            result.erase(rng() % result.size(), 1);
+        }
+        break;
+
+    default:
+        if (!result.empty())
+        {
+            result[rng() % result.size()] = letter;
+        }
+        break;
+    }
+
+    return result;
+}
+
+
+unsigned int experimentHash(const std::string& s)
+{
+    unsigned int hash = 2166136261u;
+
+    for (char c : s)
+    {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+    }
+
+    return hash;
+}
@@ -0,0 +1,43 @@
+// ExperimentWords.hpp
+//
+// Helpers that give the experiments a dictionary to work with: either the
+// words in a file (one per line, e.g., the project's words.txt), or a
+// reproducible set of made-up uppercase words when no file is given.
+
+#ifndef EXPERIMENTWORDS_HPP
+#define EXPERIMENTWORDS_HPP
+
+#include <string>
+#include <vector>
+
+
+
+// loadExperimentWords() returns the words in the file at the given path,
+// or generateExperimentWords(count) if the path is empty or the file can't
+// be opened.
+std::vector<std::string> loadExperimentWords(const std::string& path, unsigned int count = 100000);
+
+
+// generateExperimentWords() returns count distinct pseudo-random words of
+// 2 to 12 uppercase letters, the same ones every time it is called.
+std::vector<std::string> generateExperimentWords(unsigned int count);
+
+
+// topUpExperimentWords() returns the given words, followed by enough
+// distinct words from generateExperimentWords() to make count words in
+// all, if there are fewer than that.
+std::vector<std::string> topUpExperimentWords(const std::vector<std::string>& words, unsigned int count);
+
+
+// misspell() returns a copy of the given word with one pseudo-random edit
+// (a swap, insertion, deletion or replacement) applied to it.
+std::string misspell(const std::string& word, unsigned int seed);
+
+
+// experimentHash() is a simple string hash for the HashSets built by the
+// experiments.
+unsigned int experimentHash(const std::string& s);
+
+
+
+#endif
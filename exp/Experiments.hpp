@@ -0,0 +1,120 @@
+// Experiments.hpp
+//
+// Declarations of the experiments that expmain.cpp can run.  Each one is
+// given the words of a dictionary (either loaded from a file or generated,
+// see ExperimentWords.hpp) and prints what it measured to std::cout.
+
+#ifndef EXPERIMENTS_HPP
+#define EXPERIMENTS_HPP
+
+#include <string>
+#include <vector>
+
+
+
+// Compares suggestion latency of a DeletionIndex (at distances 1 and 2)
+// with WordChecker over a HashSet, and reports the index's build time.
+void runDeletionIndexExperiment(const std::vector<std::string>& words);
+
+
+// Measures BKTree query latency at edit distances 1 to 3 against an
+// exhaustive scan of the dictionary.
+void runBKTreeExperiment(const std::vector<std::string>& words);
+
+
+// Compares trie-pruned suggestions over a TrieSet with the unpruned ones
+// over a HashSet and an AVLSet.
+void runTrieExperiment(const std::vector<std::string>& words);
+
+
+// Measures distance-k queries answered by intersecting a
+// LevenshteinAutomaton with a TrieSet and with a sorted vector of words.
+void runLevenshteinAutomatonExperiment(const std::vector<std::string>& words);
+
+
+// Measures suggestions over each kind of Set with and without a
+// BloomFilter in front of it.
+void runBloomFilterExperiment(const std::vector<std::string>& words);
+
+
+// Replays Zipf-distributed misspellings through suggestion caches of a
+// few sizes.
+void runSuggestionCacheExperiment(const std::vector<std::string>& words);
+
+
+// Measures DocumentChecker throughput on a generated file.
+void runDocumentCheckerExperiment(const std::vector<std::string>& words);
+
+
+// Measures CorpusChecker throughput on generated files as threads are
+// added.
+void runCorpusCheckerExperiment(const std::vector<std::string>& words);
+
+
+// Compares findSuggestions() lookups, suggestions and latency across
+// alphabets on a lowercase dictionary with apostrophes.
+void runAlphabetExperiment(const std::vector<std::string>& words);
+
+
+// Compares pruned and unpruned two-edit suggestions on words misspelled
+// twice.
+void runTwoEditExperiment(const std::vector<std::string>& words);
+
+
+// Compares dynamic programming and bit-parallel edit distances on pairs
+// of dictionary-length words.
+void runEditDistanceExperiment(const std::vector<std::string>& words);
+
+
+// Measures findSuggestions() latency and partial results on long words
+// under lookup and deadline budgets.
+void runBudgetExperiment(const std::vector<std::string>& words);
+
+
+// Compares finding every suggestion with taking the first few from
+// lazySuggestions().
+void runLazySuggestionExperiment(const std::vector<std::string>& words);
+
+
+// Compares WordChecker's virtual lookups with BasicWordChecker's direct
+// ones over each kind of Set.
+void runStaticDispatchExperiment(const std::vector<std::string>& words);
+
+
+// Compares collecting suggestions with a std::set and with a
+// SuggestionCollector, on the suggestions for short misspelled words.
+void runSuggestionCollectorExperiment(const std::vector<std::string>& words);
+
+
+// Compares findSuggestions() with findSoundAlikes() on words respelled
+// the way they sound.
+void runPhoneticIndexExperiment(const std::vector<std::string>& words);
+
+
+// Compares the fifth technique's dynamic program with nested two-way
+// splits on run-together words.
+void runSegmentationExperiment(const std::vector<std::string>& words);
+
+
+// Compares HashSet with FlatHashSet on adds, hits, misses and
+// findSuggestions().
+void runFlatHashSetExperiment(const std::vector<std::string>& words);
+
+
+// Compares a HashSet hashing through a std::function with one whose
+// Hasher is FnvHash, including lookups of std::string_views.
+void runHasherExperiment(const std::vector<std::string>& words);
+
+
+// Measures the distribution of add() latencies while a HashSet and a
+// FlatHashSet grow to millions of words.
+void runIncrementalRehashExperiment(const std::vector<std::string>& words);
+
+
+// Measures the peak memory and time taken to load a million words into a
+// HashSet and a FlatHashSet.
+void runGrowthExperiment(const std::vector<std::string>& words);
+
+
+
+#endif
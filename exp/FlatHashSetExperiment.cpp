@@ -0,0 +1,130 @@
+// FlatHashSetExperiment.cpp
+//
+// Compares a HashSet with a FlatHashSet holding the same words: the time
+// to add them all, the time to look up words that are in the set and
+// misspellings that mostly aren't, and findSuggestions() latency through
+// WordChecker and BasicWordChecker.  Also reports how many groups the
+// FlatHashSet's lookups probe.
+
+#include <chrono>
+#include <iostream>
+#include "BasicWordChecker.hpp"
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "FlatHashSet.hpp"
+#include "HashSet.hpp"
+#include "WordChecker.hpp"
+
+
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr unsigned int REPEATS = 10;
+
+
+    double millisSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+
+    template <typename SetT>
+    double nanosPerLookup(const SetT& set, const std::vector<std::string>& queries)
+    {
+        unsigned long long found = 0;
+
+        Clock::time_point start = Clock::now();
+        for (unsigned int r = 0; r < REPEATS; ++r)
+        {
+            for (const std::string& query : queries)
+            {
+                found += set.contains(query) ? 1 : 0;
+            }
+        }
+        double nanos = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+        // Keeps the lookups from being optimized away.
+        if (found == ~0ULL)
+        {
+            std::cout << found << std::endl;
+        }
+
+        return nanos / (REPEATS * queries.size());
+    }
+
+
+    template <typename Checker>
+    double microsPerQuery(const Checker& checker, const std::vector<std::string>& queries)
+    {
+        unsigned long long suggestions = 0;
+
+        Clock::time_point start = Clock::now();
+        for (const std::string& query : queries)
+        {
+            suggestions += checker.findSuggestions(query).size();
+        }
+        double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+        if (suggestions == ~0ULL)
+        {
+            std::cout << suggestions << std::endl;
+        }
+
+        return micros / queries.size();
+    }
+
+
+    template <typename SetT>
+    void measure(const char* name, SetT& set, const std::vector<std::string>& words,
+                 const std::vector<std::string>& hits, const std::vector<std::string>& misses)
+    {
+        Clock::time_point start = Clock::now();
+        for (const std::string& word : words)
+        {
+            set.add(word);
+        }
+        double addMillis = millisSince(start);
+
+        WordChecker virtualChecker{set};
+        BasicWordChecker<SetT> staticChecker{set};
+
+        std::cout << name << "add " << addMillis << " ms, hit " << nanosPerLookup(set, hits)
+                  << " ns, miss " << nanosPerLookup(set, misses) << " ns, WordChecker "
+                  << microsPerQuery(virtualChecker, misses) << " us/query, BasicWordChecker "
+                  << microsPerQuery(staticChecker, misses) << " us/query" << std::endl;
+    }
+}
+
+
+void runFlatHashSetExperiment(const std::vector<std::string>& words)
+{
+    std::vector<std::string> hits;
+    std::vector<std::string> misses;
+    for (unsigned int i = 0; misses.size() < 2000 && i < words.size(); ++i)
+    {
+        hits.push_back(words[(i * 7919) % words.size()]);
+        misses.push_back(misspell(hits.back(), i));
+    }
+
+    HashSet<std::string> hashSet{experimentHash};
+    measure("HashSet:     ", hashSet, words, hits, misses);
+
+    FlatHashSet<std::string> flatHashSet{experimentHash};
+    measure("FlatHashSet: ", flatHashSet, words, hits, misses);
+
+    unsigned long long hitGroups = 0;
+    unsigned long long missGroups = 0;
+    for (unsigned int i = 0; i < hits.size(); ++i)
+    {
+        hitGroups += flatHashSet.groupsProbed(hits[i]);
+        missGroups += flatHashSet.groupsProbed(misses[i]);
+    }
+
+    std::cout << "FlatHashSet: " << flatHashSet.groupCount() << " groups of "
+              << FlatHashSet<std::string>::GROUP_WIDTH << ", load "
+              << static_cast<double>(flatHashSet.size()) / (flatHashSet.groupCount() * FlatHashSet<std::string>::GROUP_WIDTH)
+              << ", groups probed per hit " << static_cast<double>(hitGroups) / hits.size()
+              << ", per miss " << static_cast<double>(missGroups) / misses.size() << std::endl;
+}
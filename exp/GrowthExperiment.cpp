@@ -0,0 +1,121 @@
+// GrowthExperiment.cpp
+//
+// Loads a million-word dictionary (topped up with generated words if the
+// given one is smaller) into a HashSet and into a FlatHashSet, each in
+// its own child process, so that each one's peak resident set size, as
+// getrusage() reports it, isn't hidden by the other's.  Reports how much
+// loading raised the peak, along with the time taken and the longest
+// single add(), which is the one that allocates the largest new array.
+
+#include <chrono>
+#include <iostream>
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "FlatHashSet.hpp"
+#include "HashSet.hpp"
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+
+
+#if defined(_WIN32)
+
+void runGrowthExperiment(const std::vector<std::string>& words)
+{
+    std::cout << "The growth experiment needs fork() and getrusage()" << std::endl;
+}
+
+#else
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr unsigned int DICTIONARY_WORDS = 1000000;
+
+
+    double peakMegabytes()
+    {
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+
+        // ru_maxrss is in bytes on macOS, but kilobytes elsewhere.
+#if defined(__APPLE__)
+        return usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+        return usage.ru_maxrss / 1024.0;
+#endif
+    }
+
+
+    template <typename MakeSet>
+    void measureInChild(const char* name, const std::vector<std::string>& words, MakeSet makeSet)
+    {
+        std::cout.flush();
+
+        pid_t child = fork();
+        if (child == 0)
+        {
+            double peakBefore = peakMegabytes();
+            auto set = makeSet();
+
+            double longestMillis = 0.0;
+            Clock::time_point start = Clock::now();
+            for (const std::string& word : words)
+            {
+                Clock::time_point before = Clock::now();
+                set.add(word);
+                double millis = std::chrono::duration<double, std::milli>(Clock::now() - before).count();
+                longestMillis = millis > longestMillis ? millis : longestMillis;
+            }
+            double totalMillis = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+            std::cout << name << set.size() << " words in " << totalMillis << " ms, longest add() "
+                      << longestMillis << " ms, peak RSS +" << peakMegabytes() - peakBefore << " MB"
+                      << std::endl;
+            std::cout.flush();
+            _exit(0);
+        }
+
+        if (child < 0)
+        {
+            std::cout << name << "fork() failed" << std::endl;
+            return;
+        }
+
+        waitpid(child, nullptr, 0);
+    }
+}
+
+
+void runGrowthExperiment(const std::vector<std::string>& words)
+{
+    std::vector<std::string> dictionary = topUpExperimentWords(words, DICTIONARY_WORDS);
+
+    // Memory freed while generating the dictionary would otherwise stay
+    // resident, and the children could grow into it without raising
+    // their peaks at all.
+#if defined(__GLIBC__)
+    malloc_trim(0);
+#endif
+
+    measureInChild("HashSet:     ", dictionary, []
+    {
+        return HashSet<std::string>{experimentHash};
+    });
+
+    measureInChild("FlatHashSet: ", dictionary, []
+    {
+        return FlatHashSet<std::string>{experimentHash};
+    });
+}
+
+#endif
@@ -0,0 +1,158 @@
+// HasherExperiment.cpp
+//
+// Compares a HashSet whose FNV-1a hash is held in a std::function with
+// one whose Hasher is FnvHash itself, on the same words: looking up
+// std::strings, looking up words in a text buffer (copied into a
+// std::string first, or as std::string_views where the set allows it),
+// and BasicWordChecker::findSuggestions() on misspellings and on
+// run-together pairs of words, whose splits are looked up as views.
+
+#include <chrono>
+#include <iostream>
+#include <string_view>
+#include <type_traits>
+#include "BasicWordChecker.hpp"
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "FnvHash.hpp"
+#include "HashSet.hpp"
+
+
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr unsigned int REPEATS = 10;
+
+
+    // Keeps the results from being optimized away.
+    void consume(unsigned long long total)
+    {
+        if (total == ~0ULL)
+        {
+            std::cout << total << std::endl;
+        }
+    }
+
+
+    template <typename Lookup>
+    double nanosPerLookup(unsigned int lookups, Lookup lookup)
+    {
+        unsigned long long found = 0;
+
+        Clock::time_point start = Clock::now();
+        for (unsigned int r = 0; r < REPEATS; ++r)
+        {
+            found += lookup();
+        }
+        double nanos = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+        consume(found);
+        return nanos / (REPEATS * lookups);
+    }
+
+
+    template <typename Checker>
+    double microsPerQuery(const Checker& checker, const std::vector<std::string>& queries)
+    {
+        unsigned long long suggestions = 0;
+
+        Clock::time_point start = Clock::now();
+        for (const std::string& query : queries)
+        {
+            suggestions += checker.findSuggestions(query).size();
+        }
+        double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+        consume(suggestions);
+        return micros / queries.size();
+    }
+
+
+    template <typename SetT>
+    void measure(const char* name, SetT& set, const std::vector<std::string>& words,
+                 const std::vector<std::string>& queries, const std::string& text,
+                 const std::vector<std::string>& misspellings, const std::vector<std::string>& runTogether)
+    {
+        for (const std::string& word : words)
+        {
+            set.add(word);
+        }
+
+        double stringNanos = nanosPerLookup(queries.size(), [&]
+        {
+            unsigned int found = 0;
+            for (const std::string& query : queries)
+            {
+                found += set.contains(query) ? 1 : 0;
+            }
+            return found;
+        });
+
+        // Words in the text are separated by single spaces.
+        auto lookUpText = [&](auto lookUpWord)
+        {
+            unsigned int found = 0;
+            std::string_view rest{text};
+            while (!rest.empty())
+            {
+                std::size_t space = rest.find(' ');
+                found += lookUpWord(rest.substr(0, space)) ? 1 : 0;
+                rest.remove_prefix(space == std::string_view::npos ? rest.size() : space + 1);
+            }
+            return found;
+        };
+
+        double copyNanos = nanosPerLookup(queries.size(), [&]
+        {
+            return lookUpText([&](std::string_view word)
+            {
+                return set.contains(std::string{word});
+            });
+        });
+
+        std::cout << name << "string " << stringNanos << " ns, text copied " << copyNanos << " ns";
+
+        if constexpr (std::is_same_v<SetT, HashSet<std::string, FnvHash>>)
+        {
+            double viewNanos = nanosPerLookup(queries.size(), [&]
+            {
+                return lookUpText([&](std::string_view word)
+                {
+                    return set.contains(word);
+                });
+            });
+
+            std::cout << ", text viewed " << viewNanos << " ns";
+        }
+
+        BasicWordChecker<SetT> checker{set};
+        std::cout << ", misspellings " << microsPerQuery(checker, misspellings) << " us/query, run-together "
+                  << microsPerQuery(checker, runTogether) << " us/query" << std::endl;
+    }
+}
+
+
+void runHasherExperiment(const std::vector<std::string>& words)
+{
+    std::vector<std::string> queries;
+    std::vector<std::string> misspellings;
+    std::vector<std::string> runTogether;
+    std::string text;
+    for (unsigned int i = 0; queries.size() < 2000 && i < words.size(); ++i)
+    {
+        const std::string& word = words[(i * 7919) % words.size()];
+        queries.push_back(i % 2 == 0 ? word : misspell(word, i));
+        misspellings.push_back(misspell(word, i));
+        runTogether.push_back(word + words[(i * 104729) % words.size()]);
+
+        text += (text.empty() ? "" : " ") + queries.back();
+    }
+
+    HashSet<std::string> functionSet{[](const std::string& s) { return FnvHash{}(s); }};
+    measure("std::function: ", functionSet, words, queries, text, misspellings, runTogether);
+
+    HashSet<std::string, FnvHash> fnvSet{FnvHash{}};
+    measure("FnvHash:       ", fnvSet, words, queries, text, misspellings, runTogether);
+}
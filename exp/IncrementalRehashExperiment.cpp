@@ -0,0 +1,63 @@
+// IncrementalRehashExperiment.cpp
+//
+// Times every add() while a HashSet, which grows a couple of buckets at
+// a time, and a FlatHashSet, which moves all of its elements whenever it
+// grows, are loaded with the same words, and reports the distribution of
+// add() latencies.  The dictionary is topped up with generated words to
+// at least two million, so that the largest growth steps are large.
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "FlatHashSet.hpp"
+#include "HashSet.hpp"
+
+
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr unsigned int MINIMUM_WORDS = 2000000;
+
+
+    template <typename SetT>
+    void measure(const char* name, SetT& set, const std::vector<std::string>& words)
+    {
+        std::vector<double> nanos;
+        nanos.reserve(words.size());
+
+        Clock::time_point start = Clock::now();
+        for (const std::string& word : words)
+        {
+            Clock::time_point before = Clock::now();
+            set.add(word);
+            nanos.push_back(std::chrono::duration<double, std::nano>(Clock::now() - before).count());
+        }
+        double totalMillis = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        std::sort(nanos.begin(), nanos.end());
+        auto percentile = [&](double p)
+        {
+            return nanos[static_cast<std::size_t>(p * (nanos.size() - 1))];
+        };
+
+        std::cout << name << set.size() << " words in " << totalMillis << " ms; add() p50 "
+                  << percentile(0.5) << " ns, p99 " << percentile(0.99) << " ns, p99.9 "
+                  << percentile(0.999) << " ns, max " << nanos.back() / 1000000 << " ms" << std::endl;
+    }
+}
+
+
+void runIncrementalRehashExperiment(const std::vector<std::string>& words)
+{
+    std::vector<std::string> allWords = topUpExperimentWords(words, MINIMUM_WORDS);
+
+    HashSet<std::string> hashSet{experimentHash};
+    measure("HashSet:     ", hashSet, allWords);
+
+    FlatHashSet<std::string> flatHashSet{experimentHash};
+    measure("FlatHashSet: ", flatHashSet, allWords);
+}
@@ -0,0 +1,99 @@
+// LazySuggestionExperiment.cpp
+//
+// Misspells dictionary words, then measures the lookups and latency per
+// query of findSuggestions(), which finds and sorts every suggestion,
+// against taking just the first one, or the first five, from
+// lazySuggestions().
+
+#include <chrono>
+#include <iostream>
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "HashSet.hpp"
+#include "WordChecker.hpp"
+
+
+
+namespace
+{
+    // CountingSet counts the lookups made through it.
+    class CountingSet : public Set<std::string>
+    {
+    public:
+        explicit CountingSet(const Set<std::string>& words)
+            : words{words}, lookups{0}
+        {
+        }
+
+        bool isImplemented() const noexcept override { return true; }
+        void add(const std::string&) override { }
+        bool contains(const std::string& element) const override { lookups++; return words.contains(element); }
+        unsigned int size() const noexcept override { return words.size(); }
+
+        const Set<std::string>& words;
+        mutable unsigned long long lookups;
+    };
+
+
+    template <typename Find>
+    void measure(const char* name, const CountingSet& counting, const std::vector<std::string>& queries, Find find)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        counting.lookups = 0;
+        unsigned long long suggestions = 0;
+
+        Clock::time_point start = Clock::now();
+        for (const std::string& query : queries)
+        {
+            suggestions += find(query);
+        }
+        double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+        std::cout << name << static_cast<double>(counting.lookups) / queries.size() << " lookups/query, "
+                  << micros / queries.size() << " us/query, "
+                  << static_cast<double>(suggestions) / queries.size() << " suggestions/query" << std::endl;
+    }
+
+
+    unsigned int takeFirst(const WordChecker& checker, const std::string& word, unsigned int count)
+    {
+        unsigned int taken = 0;
+        SuggestionRange range = checker.lazySuggestions(word);
+
+        while (taken < count && range.next())
+        {
+            taken++;
+        }
+
+        return taken;
+    }
+}
+
+
+void runLazySuggestionExperiment(const std::vector<std::string>& words)
+{
+    HashSet<std::string> set{experimentHash};
+    for (const std::string& word : words)
+    {
+        set.add(word);
+    }
+
+    std::vector<std::string> queries;
+    for (unsigned int i = 0; queries.size() < 10000 && i < words.size(); ++i)
+    {
+        queries.push_back(misspell(words[(i * 7919) % words.size()], i));
+    }
+
+    CountingSet counting{set};
+    WordChecker checker{counting};
+
+    measure("findSuggestions():     ", counting, queries,
+            [&](const std::string& q) { return checker.findSuggestions(q).size(); });
+    measure("All, lazily:           ", counting, queries,
+            [&](const std::string& q) { return takeFirst(checker, q, ~0u); });
+    measure("First five, lazily:    ", counting, queries,
+            [&](const std::string& q) { return takeFirst(checker, q, 5); });
+    measure("First one, lazily:     ", counting, queries,
+            [&](const std::string& q) { return takeFirst(checker, q, 1); });
+}
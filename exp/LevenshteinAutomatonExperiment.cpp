@@ -0,0 +1,57 @@
+// LevenshteinAutomatonExperiment.cpp
+//
+// Measures the latency of finding every word within edit distances 1 to 3
+// by intersecting a LevenshteinAutomaton with a TrieSet and with a sorted
+// vector of words.  Compare with the "bk-tree" experiment.
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "LevenshteinAutomaton.hpp"
+#include "TrieSet.hpp"
+
+
+
+void runLevenshteinAutomatonExperiment(const std::vector<std::string>& words)
+{
+    using Clock = std::chrono::steady_clock;
+
+    TrieSet trie;
+    for (const std::string& word : words)
+    {
+        trie.add(word);
+    }
+
+    std::vector<std::string> sortedWords = words;
+    std::sort(sortedWords.begin(), sortedWords.end());
+
+    std::vector<std::string> queries;
+    for (unsigned int i = 0; i < 200 && i < words.size(); ++i)
+    {
+        queries.push_back(misspell(words[i * 13 % words.size()], i));
+    }
+
+    for (unsigned int k = 1; k <= 3; ++k)
+    {
+        Clock::time_point start = Clock::now();
+        std::size_t found = 0;
+        for (const std::string& query : queries)
+        {
+            found += LevenshteinAutomaton{query, k}.intersect(trie).size();
+        }
+        double trieMicros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+        start = Clock::now();
+        for (const std::string& query : queries)
+        {
+            LevenshteinAutomaton{query, k}.intersect(sortedWords);
+        }
+        double sortedMicros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+        std::cout << "k = " << k << ": trie " << trieMicros / queries.size()
+                  << " us/query, sorted words " << sortedMicros / queries.size()
+                  << " us/query, " << found << " words" << std::endl;
+    }
+}
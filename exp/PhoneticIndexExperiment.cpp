@@ -0,0 +1,140 @@
+// PhoneticIndexExperiment.cpp
+//
+// Respells dictionary words the way they sound -- changing their vowels,
+// writing "PH" as "F" and a hard "C" as "K", and undoubling doubled
+// letters -- then measures, for the respellings that are more than one
+// edit from the original, how often findSuggestions() and
+// findSoundAlikes() suggest the original word, and how long each takes.
+// Also reports how big the PhoneticIndex's buckets are, since a query
+// returns a whole bucket.
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include "EditDistance.hpp"
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "HashSet.hpp"
+#include "PhoneticIndex.hpp"
+#include "WordChecker.hpp"
+
+
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+
+    bool isVowel(char c)
+    {
+        return c == 'A' || c == 'E' || c == 'I' || c == 'O' || c == 'U';
+    }
+
+
+    std::string respell(const std::string& word, unsigned int seed)
+    {
+        std::mt19937 rng{seed};
+        std::string result;
+
+        for (std::size_t i = 0; i < word.size(); ++i)
+        {
+            char c = word[i];
+            char next = i + 1 < word.size() ? word[i + 1] : '\0';
+
+            if (i > 0 && c == word[i - 1] && c != 'C')
+            {
+                continue;
+            }
+            else if (c == 'P' && next == 'H')
+            {
+                result += 'F';
+                ++i;
+            }
+            else if (c == 'C' && (next == 'A' || next == 'O' || next == 'U'))
+            {
+                result += 'K';
+            }
+            else if (i > 0 && isVowel(c) && rng() % 2 == 0)
+            {
+                result += "AEIOU"[rng() % 5];
+            }
+            else
+            {
+                result += c;
+            }
+        }
+
+        return result;
+    }
+
+
+    template <typename Find>
+    void measure(const char* name, const std::vector<std::string>& originals,
+                 const std::vector<std::string>& queries, Find find)
+    {
+        unsigned int found = 0;
+        unsigned long long suggestions = 0;
+
+        Clock::time_point start = Clock::now();
+        for (std::size_t i = 0; i < queries.size(); ++i)
+        {
+            std::vector<std::string> result = find(queries[i]);
+            suggestions += result.size();
+            for (const std::string& suggestion : result)
+            {
+                if (suggestion == originals[i])
+                {
+                    found++;
+                }
+            }
+        }
+        double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+        std::cout << name << micros / queries.size() << " us/query, "
+                  << static_cast<double>(suggestions) / queries.size() << " suggestions/query, original found for "
+                  << found << " of " << queries.size() << std::endl;
+    }
+}
+
+
+void runPhoneticIndexExperiment(const std::vector<std::string>& words)
+{
+    HashSet<std::string> set{experimentHash};
+    for (const std::string& word : words)
+    {
+        set.add(word);
+    }
+
+    PhoneticIndex index;
+    Clock::time_point start = Clock::now();
+    for (const std::string& word : words)
+    {
+        index.add(word);
+    }
+    double buildMillis = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    std::cout << "PhoneticIndex: " << index.size() << " words in " << index.bucketCount() << " buckets ("
+              << static_cast<double>(index.size()) / index.bucketCount() << " per bucket, largest "
+              << index.largestBucket() << "), built in " << buildMillis << " ms" << std::endl;
+
+    std::vector<std::string> originals;
+    std::vector<std::string> queries;
+    for (unsigned int i = 0; queries.size() < 1000 && i < words.size(); ++i)
+    {
+        const std::string& word = words[(i * 7919) % words.size()];
+        std::string query = respell(word, i);
+        if (damerauDistance(word, query) >= 2 && !set.contains(query))
+        {
+            originals.push_back(word);
+            queries.push_back(query);
+        }
+    }
+
+    WordChecker checker{set};
+    checker.usePhoneticIndex(index);
+
+    measure("findSuggestions(): ", originals, queries,
+            [&](const std::string& q) { return checker.findSuggestions(q); });
+    measure("findSoundAlikes(): ", originals, queries,
+            [&](const std::string& q) { return checker.findSoundAlikes(q); });
+}
@@ -0,0 +1,124 @@
+// SegmentationExperiment.cpp
+//
+// Runs three to five dictionary words together, as OCR often does, then
+// measures how the fifth technique's dynamic program splits them: its
+// lookups and latency per query, and how often it recovers a split into
+// as few words as were run together.  For comparison, it also splits them
+// by nesting the two-way split, trying every first word and splitting the
+// rest the same way, which is exponential; that gives up on a query after
+// a million lookups.
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "HashSet.hpp"
+#include "SuggestionTechniques.hpp"
+
+
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr unsigned long long NESTED_LOOKUP_LIMIT = 1000000;
+
+
+    // fewestNested() returns the fewest words the given string splits into
+    // (0 if it can't be split, or the limit is reached) by nesting the
+    // two-way split, counting its lookups.
+    unsigned int fewestNested(const HashSet<std::string>& set, const std::string& s, unsigned long long& lookups)
+    {
+        unsigned int fewest = 0;
+
+        for (std::size_t a = 1; a <= s.size() && lookups < NESTED_LOOKUP_LIMIT; ++a)
+        {
+            lookups++;
+            if (!set.contains(s.substr(0, a)))
+            {
+                continue;
+            }
+            if (a == s.size())
+            {
+                return 1;
+            }
+
+            unsigned int rest = fewestNested(set, s.substr(a), lookups);
+            if (rest != 0 && (fewest == 0 || rest + 1 < fewest))
+            {
+                fewest = rest + 1;
+            }
+        }
+
+        return fewest;
+    }
+}
+
+
+void runSegmentationExperiment(const std::vector<std::string>& words)
+{
+    HashSet<std::string> set{experimentHash};
+    for (const std::string& word : words)
+    {
+        set.add(word);
+    }
+
+    std::vector<std::string> queries;
+    std::vector<unsigned int> joined;
+    for (unsigned int i = 0; queries.size() < 200 && i < words.size(); ++i)
+    {
+        unsigned int count = 3 + i % 3;
+        std::string query;
+        for (unsigned int w = 0; w < count; ++w)
+        {
+            query += words[(i * 7919 + w * 104729) % words.size()];
+        }
+        queries.push_back(query);
+        joined.push_back(count);
+    }
+
+    unsigned long long lookups = 0;
+    unsigned int recovered = 0;
+    Clock::time_point start = Clock::now();
+    for (std::size_t i = 0; i < queries.size(); ++i)
+    {
+        unsigned int fewest = 0;
+        forEachSplit(queries[i], [&](const std::string& part)
+        {
+            lookups++;
+            return set.contains(part);
+        }, [&](const std::string& split, SuggestionTechnique)
+        {
+            fewest = std::max(fewest, static_cast<unsigned int>(std::count(split.begin(), split.end(), ' ') + 1));
+        }, UnlimitedBudget{});
+
+        if (fewest != 0 && fewest <= joined[i])
+        {
+            recovered++;
+        }
+    }
+    double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+    std::cout << "Dynamic program: " << static_cast<double>(lookups) / queries.size() << " lookups/query, "
+              << micros / queries.size() << " us/query, split into at most as many words for "
+              << recovered << " of " << queries.size() << std::endl;
+
+    lookups = 0;
+    unsigned int gaveUp = 0;
+    start = Clock::now();
+    for (const std::string& query : queries)
+    {
+        unsigned long long queryLookups = 0;
+        fewestNested(set, query, queryLookups);
+        if (queryLookups >= NESTED_LOOKUP_LIMIT)
+        {
+            gaveUp++;
+        }
+        lookups += queryLookups;
+    }
+    micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+    std::cout << "Nested splits:   " << static_cast<double>(lookups) / queries.size() << " lookups/query, "
+              << micros / queries.size() << " us/query, gave up on " << gaveUp << " of " << queries.size() << std::endl;
+}
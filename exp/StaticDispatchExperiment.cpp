@@ -0,0 +1,83 @@
+// StaticDispatchExperiment.cpp
+//
+// Measures findSuggestions() latency for WordChecker, which looks every
+// candidate up through the virtual Set<std::string>::contains(), against
+// BasicWordChecker, which calls the concrete Set's contains() directly,
+// over a HashSet, an AVLSet and a SkipListSet holding the same words.
+
+#include <chrono>
+#include <iostream>
+#include "AVLSet.hpp"
+#include "BasicWordChecker.hpp"
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "HashSet.hpp"
+#include "SkipListSet.hpp"
+#include "WordChecker.hpp"
+
+
+
+namespace
+{
+    template <typename Checker>
+    double microsPerQuery(const Checker& checker, const std::vector<std::string>& queries)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        unsigned long long suggestions = 0;
+
+        Clock::time_point start = Clock::now();
+        for (const std::string& query : queries)
+        {
+            suggestions += checker.findSuggestions(query).size();
+        }
+        double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+        // Keeps the suggestions from being optimized away.
+        if (suggestions == ~0ULL)
+        {
+            std::cout << suggestions << std::endl;
+        }
+
+        return micros / queries.size();
+    }
+
+
+    template <typename SetT>
+    void measure(const char* name, SetT& set, const std::vector<std::string>& words,
+                 const std::vector<std::string>& queries)
+    {
+        for (const std::string& word : words)
+        {
+            set.add(word);
+        }
+
+        WordChecker virtualChecker{set};
+        BasicWordChecker<SetT> staticChecker{set};
+
+        double virtualMicros = microsPerQuery(virtualChecker, queries);
+        double staticMicros = microsPerQuery(staticChecker, queries);
+
+        std::cout << name << "WordChecker " << virtualMicros << " us/query, BasicWordChecker "
+                  << staticMicros << " us/query (" << virtualMicros / staticMicros << "x)" << std::endl;
+    }
+}
+
+
+void runStaticDispatchExperiment(const std::vector<std::string>& words)
+{
+    std::vector<std::string> queries;
+    for (unsigned int i = 0; queries.size() < 2000 && i < words.size(); ++i)
+    {
+        queries.push_back(misspell(words[(i * 7919) % words.size()], i));
+    }
+
+    HashSet<std::string> hashSet{experimentHash};
+    measure("HashSet:     ", hashSet, words, queries);
+
+    AVLSet<std::string> avlSet;
+    measure("AVLSet:      ", avlSet, words, queries);
+
+    SkipListSet<std::string> skipListSet;
+    measure("SkipListSet: ", skipListSet, words, queries);
+}
@@ -0,0 +1,64 @@
+// SuggestionCacheExperiment.cpp
+//
+// Replays a Zipf-distributed stream of misspellings (a few very common,
+// most rare, as real typos are) through WordChecker::findSuggestions() with
+// suggestion caches of a few sizes, reporting hit rates and latency.
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "HashSet.hpp"
+#include "WordChecker.hpp"
+
+
+
+void runSuggestionCacheExperiment(const std::vector<std::string>& words)
+{
+    using Clock = std::chrono::steady_clock;
+
+    HashSet<std::string> set{experimentHash};
+    for (const std::string& word : words)
+    {
+        set.add(word);
+    }
+
+    // Misspelling i is drawn with probability proportional to 1 / (i + 1).
+    std::vector<std::string> misspellings;
+    std::vector<double> weights;
+    for (unsigned int i = 0; i < 20000 && i < words.size(); ++i)
+    {
+        misspellings.push_back(misspell(words[i * 7 % words.size()], i));
+        weights.push_back(1.0 / (i + 1));
+    }
+
+    std::mt19937 rng{46};
+    std::discrete_distribution<unsigned int> zipf{weights.begin(), weights.end()};
+    std::vector<std::string> stream;
+    for (unsigned int i = 0; i < 50000; ++i)
+    {
+        stream.push_back(misspellings[zipf(rng)]);
+    }
+
+    for (unsigned int capacity : {0u, 100u, 1000u, 10000u})
+    {
+        WordChecker checker{set};
+        checker.enableSuggestionCache(capacity);
+
+        Clock::time_point start = Clock::now();
+        for (const std::string& word : stream)
+        {
+            checker.findSuggestions(word);
+        }
+        double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+        LRUCacheStats stats = checker.suggestionCacheStats();
+        double lookups = stats.hits + stats.misses;
+        std::cout << "capacity " << capacity << ": "
+                  << (lookups == 0 ? 0.0 : 100.0 * stats.hits / lookups) << "% hits, "
+                  << stats.evictions << " evictions, "
+                  << micros / stream.size() << " us/query" << std::endl;
+    }
+}
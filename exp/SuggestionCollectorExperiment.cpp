@@ -0,0 +1,115 @@
+// SuggestionCollectorExperiment.cpp
+//
+// Captures the suggestions findSuggestions() finds for short misspelled
+// words, which have the most, then replays them to measure the cost of
+// collecting them without repeats into a sorted vector: with a std::set,
+// as findSuggestions() once did, and with a SuggestionCollector, sorted
+// and unsorted.  Also measures findSuggestions() itself, sorted and
+// unsorted, on the same words.
+
+#include <chrono>
+#include <iostream>
+#include <set>
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "HashSet.hpp"
+#include "SuggestionCollector.hpp"
+#include "WordChecker.hpp"
+
+
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr unsigned int REPEATS = 20;
+
+
+    template <typename Collect>
+    void measure(const char* name, const std::vector<std::vector<std::string>>& streams, Collect collect)
+    {
+        unsigned long long collected = 0;
+
+        Clock::time_point start = Clock::now();
+        for (unsigned int r = 0; r < REPEATS; ++r)
+        {
+            for (const std::vector<std::string>& stream : streams)
+            {
+                collected += collect(stream).size();
+            }
+        }
+        double nanos = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+        std::cout << name << nanos / (REPEATS * streams.size()) << " ns/query ("
+                  << static_cast<double>(collected) / (REPEATS * streams.size()) << " suggestions)" << std::endl;
+    }
+}
+
+
+void runSuggestionCollectorExperiment(const std::vector<std::string>& words)
+{
+    HashSet<std::string> set{experimentHash};
+    for (const std::string& word : words)
+    {
+        set.add(word);
+    }
+    WordChecker checker{set};
+
+    std::vector<std::string> queries;
+    for (unsigned int i = 0; queries.size() < 2000 && i < words.size(); ++i)
+    {
+        const std::string& word = words[(i * 7919) % words.size()];
+        if (word.size() <= 4)
+        {
+            queries.push_back(misspell(word, i));
+        }
+    }
+
+    // Each stream is a query's suggestions in the order they were found,
+    // with every one repeated, as a word found at two positions would be.
+    std::vector<std::vector<std::string>> streams;
+    for (const std::string& query : queries)
+    {
+        std::vector<std::string> stream = checker.findSuggestions(query, SuggestionOrder::Found);
+        std::vector<std::string> repeated = stream;
+        repeated.insert(repeated.end(), stream.begin(), stream.end());
+        streams.push_back(repeated);
+    }
+
+    measure("std::set:                      ", streams, [](const std::vector<std::string>& stream)
+    {
+        std::set<std::string> tempSet;
+        for (const std::string& suggestion : stream)
+        {
+            tempSet.insert(suggestion);
+        }
+        return std::vector<std::string>(tempSet.begin(), tempSet.end());
+    });
+
+    for (SuggestionOrder order : {SuggestionOrder::Sorted, SuggestionOrder::Found})
+    {
+        measure(order == SuggestionOrder::Sorted ? "SuggestionCollector, sorted:   " : "SuggestionCollector, unsorted: ",
+                streams, [order](const std::vector<std::string>& stream)
+        {
+            SuggestionCollector collector;
+            for (const std::string& suggestion : stream)
+            {
+                collector.add(suggestion);
+            }
+            return collector.suggestions(order);
+        });
+    }
+
+    for (SuggestionOrder order : {SuggestionOrder::Sorted, SuggestionOrder::Found})
+    {
+        Clock::time_point start = Clock::now();
+        for (const std::string& query : queries)
+        {
+            checker.findSuggestions(query, order);
+        }
+        double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+        std::cout << (order == SuggestionOrder::Sorted ? "findSuggestions(), sorted:     " : "findSuggestions(), unsorted:   ")
+                  << micros / queries.size() << " us/query" << std::endl;
+    }
+}
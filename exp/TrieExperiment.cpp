@@ -0,0 +1,87 @@
+// TrieExperiment.cpp
+//
+// Compares WordChecker::findSuggestions() over a TrieSet, where candidates
+// are pruned as the trie is walked, with the same calls over a HashSet and
+// an AVLSet, where every candidate is looked up in full.  A Set that
+// counts its calls to contains() shows how many full lookups the unpruned
+// techniques make.
+
+#include <chrono>
+#include <iostream>
+#include "AVLSet.hpp"
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "HashSet.hpp"
+#include "TrieSet.hpp"
+#include "WordChecker.hpp"
+
+
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+
+    class CountingSet : public Set<std::string>
+    {
+    public:
+        explicit CountingSet(const Set<std::string>& s)
+            : s{s}, lookups{0}
+        {
+        }
+
+        bool isImplemented() const noexcept override { return true; }
+        void add(const std::string&) override { }
+        bool contains(const std::string& element) const override { ++lookups; return s.contains(element); }
+        unsigned int size() const noexcept override { return s.size(); }
+
+        const Set<std::string>& s;
+        mutable unsigned long lookups;
+    };
+
+
+    void timeChecker(const char* name, const WordChecker& checker, const std::vector<std::string>& queries)
+    {
+        Clock::time_point start = Clock::now();
+        std::size_t found = 0;
+        for (const std::string& query : queries)
+        {
+            found += checker.findSuggestions(query).size();
+        }
+        double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        std::cout << name << micros / queries.size() << " us/query, " << found << " suggestions" << std::endl;
+    }
+}
+
+
+void runTrieExperiment(const std::vector<std::string>& words)
+{
+    HashSet<std::string> hashSet{experimentHash};
+    AVLSet<std::string> avlSet;
+    TrieSet trieSet;
+
+    for (const std::string& word : words)
+    {
+        hashSet.add(word);
+        avlSet.add(word);
+        trieSet.add(word);
+    }
+
+    std::vector<std::string> queries;
+    for (unsigned int i = 0; i < 5000 && i < words.size(); ++i)
+    {
+        queries.push_back(misspell(words[i * 7 % words.size()], i));
+    }
+
+    CountingSet counting{hashSet};
+    WordChecker countingChecker{counting};
+    for (const std::string& query : queries)
+    {
+        countingChecker.findSuggestions(query);
+    }
+    std::cout << "Unpruned full lookups: " << counting.lookups / queries.size() << " per query" << std::endl;
+
+    timeChecker("HashSet: ", WordChecker{hashSet}, queries);
+    timeChecker("AVLSet:  ", WordChecker{avlSet}, queries);
+    timeChecker("TrieSet: ", WordChecker{trieSet}, queries);
+}
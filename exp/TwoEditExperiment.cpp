@@ -0,0 +1,143 @@
+// TwoEditExperiment.cpp
+//
+// Misspells dictionary words of eight or more letters twice, then measures
+// the TwoEdits form of findSuggestions(), pruned by a DeletionIndex and by
+// a TrieSet, against applying every technique to every intermediate with
+// nothing pruned: Set lookups and latency per query, and how often the
+// original word is among the suggestions.
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include "DeletionIndex.hpp"
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+#include "HashSet.hpp"
+#include "TrieSet.hpp"
+#include "WordChecker.hpp"
+
+
+
+namespace
+{
+    // CountingSet counts the lookups made through it.
+    class CountingSet : public Set<std::string>
+    {
+    public:
+        explicit CountingSet(const Set<std::string>& words)
+            : words{words}, lookups{0}
+        {
+        }
+
+        bool isImplemented() const noexcept override { return true; }
+        void add(const std::string&) override { }
+        bool contains(const std::string& element) const override { lookups++; return words.contains(element); }
+        unsigned int size() const noexcept override { return words.size(); }
+
+        const Set<std::string>& words;
+        mutable unsigned long long lookups;
+    };
+
+
+    std::vector<std::string> bruteForce(const WordChecker& checker, const std::string& word)
+    {
+        std::vector<std::string> result = checker.findSuggestions(word);
+
+        auto expand = [&](const std::string& intermediate)
+        {
+            std::vector<std::string> more = checker.findSuggestions(intermediate);
+            result.insert(result.end(), more.begin(), more.end());
+        };
+
+        for (std::size_t i = 0; i <= word.size(); ++i)
+        {
+            if (i + 1 < word.size())
+            {
+                std::string s = word;
+                std::swap(s[i], s[i + 1]);
+                expand(s);
+            }
+            for (char c = 'A'; c <= 'Z'; ++c)
+            {
+                expand(word.substr(0, i) + c + word.substr(i));
+                if (i < word.size())
+                {
+                    expand(word.substr(0, i) + c + word.substr(i + 1));
+                }
+            }
+            if (i < word.size())
+            {
+                expand(word.substr(0, i) + word.substr(i + 1));
+            }
+        }
+
+        return result;
+    }
+
+
+    template <typename Find>
+    void measure(const char* name, const CountingSet& counting, const std::vector<std::string>& originals,
+                 const std::vector<std::string>& queries, Find find)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        counting.lookups = 0;
+        unsigned int found = 0;
+
+        Clock::time_point start = Clock::now();
+        for (std::size_t i = 0; i < queries.size(); ++i)
+        {
+            std::vector<std::string> suggestions = find(queries[i]);
+            if (std::find(suggestions.begin(), suggestions.end(), originals[i]) != suggestions.end())
+            {
+                found++;
+            }
+        }
+        double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+        std::cout << name << static_cast<double>(counting.lookups) / queries.size() << " lookups/query, "
+                  << micros / queries.size() << " us/query, original found for "
+                  << found << " of " << queries.size() << std::endl;
+    }
+}
+
+
+void runTwoEditExperiment(const std::vector<std::string>& words)
+{
+    HashSet<std::string> set{experimentHash};
+    DeletionIndex index;
+    TrieSet trie;
+    for (const std::string& word : words)
+    {
+        set.add(word);
+        index.add(word);
+        trie.add(word);
+    }
+
+    std::vector<std::string> originals;
+    std::vector<std::string> queries;
+    for (unsigned int i = 0; queries.size() < 100 && i < words.size(); ++i)
+    {
+        const std::string& word = words[(i * 7919) % words.size()];
+        if (word.size() >= 8)
+        {
+            originals.push_back(word);
+            queries.push_back(misspell(misspell(word, i), i + 104729));
+        }
+    }
+
+    CountingSet counting{set};
+    WordChecker plain{counting};
+    WordChecker indexed{counting};
+    indexed.useDeletionIndex(index);
+    WordChecker walked{trie};
+
+    measure("One edit:              ", counting, originals, queries,
+            [&](const std::string& q) { return plain.findSuggestions(q); });
+    measure("Unpruned second round: ", counting, originals, queries,
+            [&](const std::string& q) { return bruteForce(plain, q); });
+    measure("DeletionIndex pruning: ", counting, originals, queries,
+            [&](const std::string& q) { return indexed.findSuggestions(q, SuggestionDepth::TwoEdits); });
+    measure("TrieSet pruning:       ", counting, originals, queries,
+            [&](const std::string& q) { return walked.findSuggestions(q, SuggestionDepth::TwoEdits); });
+}
@@ -0,0 +1,166 @@
+// allocmain.cpp
+//
+// Measures how many heap allocations WordChecker::findSuggestions() makes
+// per call.  Counting every allocation means replacing the global
+// operator new and operator delete, which would affect every program it
+// was linked into, so this experiment is a program of its own rather
+// than one of the experiments that expmain.cpp runs.  It is built from
+// this file, exp/ExperimentWords.cpp and the core sources (see README.md).
+//
+// Usage: allocations [dictionary file]
+//
+// The count is only collected while a findSuggestions() call is being
+// measured.
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include "ExperimentWords.hpp"
+#include "HashSet.hpp"
+#include "WordChecker.hpp"
+
+
+
+namespace
+{
+    std::atomic<bool> counting{false};
+    std::atomic<unsigned long> allocations{0};
+
+
+    void* allocate(std::size_t size) noexcept
+    {
+        if (counting)
+        {
+            ++allocations;
+        }
+
+        return std::malloc(size == 0 ? 1 : size);
+    }
+
+
+    void* allocateOrThrow(std::size_t size)
+    {
+        if (void* p = allocate(size))
+        {
+            return p;
+        }
+
+        throw std::bad_alloc{};
+    }
+}
+
+
+// Every replaceable form of operator new and operator delete is replaced,
+// so that no allocation goes uncounted and every block is released by the
+// same allocator that made it.  (The aligned forms are left alone; nothing
+// measured here uses over-aligned types.)
+
+void* operator new(std::size_t size)
+{
+    return allocateOrThrow(size);
+}
+
+
+void* operator new[](std::size_t size)
+{
+    return allocateOrThrow(size);
+}
+
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+
+int main(int argc, char** argv)
+{
+    std::vector<std::string> words = loadExperimentWords(argc > 1 ? argv[1] : "");
+
+    HashSet<std::string> set{experimentHash};
+
+    for (const std::string& word : words)
+    {
+        set.add(word);
+    }
+
+    WordChecker checker{set};
+
+    // word length -> (calls, allocations, suggestions found)
+    std::map<std::size_t, std::array<unsigned long, 3>> byLength;
+
+    for (unsigned int i = 0; i < 20000 && i < words.size(); ++i)
+    {
+        std::string query = misspell(words[i], i);
+
+        allocations = 0;
+        counting = true;
+        std::vector<std::string> suggestions = checker.findSuggestions(query);
+        counting = false;
+
+        std::array<unsigned long, 3>& row = byLength[query.size()];
+        row[0] += 1;
+        row[1] += allocations;
+        row[2] += suggestions.size();
+    }
+
+    std::cout << "Allocations per findSuggestions() call" << std::endl;
+    std::cout << std::setw(8) << "length" << std::setw(10) << "calls"
+              << std::setw(16) << "allocs/call" << std::setw(16) << "found/call" << std::endl;
+
+    for (const auto& [length, row] : byLength)
+    {
+        std::cout << std::setw(8) << length << std::setw(10) << row[0]
+                  << std::setw(16) << std::fixed << std::setprecision(2)
+                  << static_cast<double>(row[1]) / row[0]
+                  << std::setw(16) << static_cast<double>(row[2]) / row[0] << std::endl;
+    }
+
+    return 0;
+}
@@ -6,12 +6,74 @@
 // Do whatever you'd like here.  This is intended to allow you to experiment
 // with your code, outside of the context of the broader program or Google
 // Test.
+//
+// Usage: exp <experiment> [dictionary file]
+//
+// Without a dictionary file, the experiments run on a generated one (see
+// ExperimentWords.hpp).
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Experiments.hpp"
+#include "ExperimentWords.hpp"
+
+
+namespace
+{
+    struct Experiment
+    {
+        const char* name;
+        void (*run)(const std::vector<std::string>& words);
+    };
+
+    const Experiment experiments[] =
+    {
+        {"deletion-index", runDeletionIndexExperiment},
+        {"bk-tree", runBKTreeExperiment},
+        {"trie", runTrieExperiment},
+        {"automaton", runLevenshteinAutomatonExperiment},
+        {"bloom-filter", runBloomFilterExperiment},
+        {"suggestion-cache", runSuggestionCacheExperiment},
+        {"document", runDocumentCheckerExperiment},
+        {"corpus", runCorpusCheckerExperiment},
+        {"alphabet", runAlphabetExperiment},
+        {"two-edits", runTwoEditExperiment},
+        {"edit-distance", runEditDistanceExperiment},
+        {"budget", runBudgetExperiment},
+        {"lazy", runLazySuggestionExperiment},
+        {"static-dispatch", runStaticDispatchExperiment},
+        {"dedup", runSuggestionCollectorExperiment},
+        {"phonetic", runPhoneticIndexExperiment},
+        {"segmentation", runSegmentationExperiment},
+        {"flat-hash-set", runFlatHashSetExperiment},
+        {"hasher", runHasherExperiment},
+        {"incremental-rehash", runIncrementalRehashExperiment},
+        {"growth", runGrowthExperiment},
+    };
+}
 
 
-int main()
+int main(int argc, char** argv)
 {
+    std::string name = argc > 1 ? argv[1] : "";
 
+    for (const Experiment& experiment : experiments)
+    {
+        if (name == experiment.name)
+        {
+            experiment.run(loadExperimentWords(argc > 2 ? argv[2] : ""));
+            return 0;
+        }
+    }
+
+    std::cout << "Usage: exp <experiment> [dictionary file]" << std::endl;
+    std::cout << "Experiments:";
+    for (const Experiment& experiment : experiments)
+    {
+        std::cout << " " << experiment.name;
+    }
+    std::cout << std::endl;
 
     return 0;
 }
-
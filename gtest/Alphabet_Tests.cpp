@@ -0,0 +1,82 @@
+// Alphabet_Tests.cpp
+//
+// Unit tests for the compile-time alphabets, and for the alphabets
+// WordChecker::findSuggestions() can insert and replace characters from.
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "Alphabet.hpp"
+#include "AVLSet.hpp"
+#include "TrieSet.hpp"
+#include "WordChecker.hpp"
+
+
+TEST(Alphabet_Tests, unionsConcatenateLettersInOrder)
+{
+    static_assert(MixedCaseAlphabet::letters.size() == 52);
+    static_assert(LowercaseApostropheAlphabet::letters.back() == '\'');
+
+    EXPECT_EQ("0123456789'", (AlphabetUnion<DigitAlphabet, ApostropheAlphabet>::letters));
+    EXPECT_EQ('A', AlphanumericAlphabet::letters.front());
+    EXPECT_EQ('9', AlphanumericAlphabet::letters.back());
+}
+
+
+TEST(Alphabet_Tests, containsOnlyItsLetters)
+{
+    static_assert(alphabetContains<LowercaseApostropheAlphabet>('\''));
+    static_assert(!alphabetContains<LowercaseAlphabet>('A'));
+
+    EXPECT_TRUE(alphabetContains<AlphanumericAlphabet>('7'));
+    EXPECT_FALSE(alphabetContains<MixedCaseAlphabet>('7'));
+    EXPECT_FALSE(alphabetContains<UppercaseAlphabet>('\xC3'));
+}
+
+
+TEST(Alphabet_Tests, uppercaseIsTheDefault)
+{
+    AVLSet<std::string> set;
+    set.add("cat");
+    set.add("CART");
+    WordChecker checker{set};
+
+    EXPECT_EQ((std::vector<std::string>{"CART"}), checker.findSuggestions("CAT"));
+    EXPECT_TRUE(checker.findSuggestions("ct").empty());
+}
+
+
+TEST(Alphabet_Tests, lowercaseWithApostrophesFindsLowercaseSuggestions)
+{
+    AVLSet<std::string> set;
+    TrieSet trie;
+    for (const char* word : {"don't", "dint", "cat", "CAT"})
+    {
+        set.add(word);
+        trie.add(word);
+    }
+
+    for (const Set<std::string>* words : std::vector<const Set<std::string>*>{&set, &trie})
+    {
+        WordChecker checker{*words};
+        checker.useAlphabet(SuggestionAlphabet::LowercaseApostrophe);
+
+        EXPECT_EQ((std::vector<std::string>{"dint", "don't"}), checker.findSuggestions("dont"));
+        EXPECT_EQ((std::vector<std::string>{"cat"}), checker.findSuggestions("ct"));
+        EXPECT_EQ((std::vector<std::string>{"cat"}), checker.findSuggestions("cAt"));
+    }
+}
+
+
+TEST(Alphabet_Tests, changingTheAlphabetEmptiesTheSuggestionCache)
+{
+    AVLSet<std::string> set;
+    set.add("a1");
+    WordChecker checker{set};
+    checker.enableSuggestionCache(10);
+
+    EXPECT_TRUE(checker.findSuggestions("a").empty());
+
+    checker.useAlphabet(SuggestionAlphabet::Alphanumeric);
+    EXPECT_EQ((std::vector<std::string>{"a1"}), checker.findSuggestions("a"));
+}
@@ -0,0 +1,109 @@
+// BKTree_Tests.cpp
+//
+// Unit tests for BKTree, and for the WordChecker queries that use one.
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "AVLSet.hpp"
+#include "BKTree.hpp"
+#include "EditDistance.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    std::vector<std::string> randomWords(unsigned int count, unsigned int seed)
+    {
+        std::mt19937 rng{seed};
+        std::vector<std::string> words;
+
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            std::string word(1 + rng() % 8, ' ');
+
+            for (char& c : word)
+            {
+                c = static_cast<char>('A' + rng() % 5);
+            }
+
+            words.push_back(word);
+        }
+
+        return words;
+    }
+}
+
+
+TEST(BKTree_Tests, ignoresDuplicates)
+{
+    BKTree tree;
+    tree.add("HELLO");
+    tree.add("HELLO");
+    tree.add("HELP");
+
+    EXPECT_EQ(2, tree.size());
+}
+
+
+TEST(BKTree_Tests, emptyTreeFindsNothing)
+{
+    BKTree tree;
+
+    EXPECT_TRUE(tree.findWithinDistance("HELLO", 3).empty());
+}
+
+
+TEST(BKTree_Tests, findsSameWordsAsExhaustiveSearch)
+{
+    std::vector<std::string> dictionary = randomWords(1500, 46);
+    BKTree tree;
+
+    for (const std::string& word : dictionary)
+    {
+        tree.add(word);
+    }
+
+    std::sort(dictionary.begin(), dictionary.end());
+    dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
+
+    for (const std::string& query : randomWords(100, 47))
+    {
+        for (unsigned int k = 0; k <= 3; ++k)
+        {
+            std::vector<std::string> expected;
+
+            for (const std::string& word : dictionary)
+            {
+                if (levenshteinDistance(query, word) <= k)
+                {
+                    expected.push_back(word);
+                }
+            }
+
+            ASSERT_EQ(expected, tree.findWithinDistance(query, k)) << query << " " << k;
+        }
+    }
+}
+
+
+TEST(BKTree_Tests, wordCheckerFindsWordsWithinDistance)
+{
+    AVLSet<std::string> set;
+    set.add("RECEIVE");
+    set.add("RECIPE");
+    set.add("DECEIVE");
+    set.add("BANANA");
+
+    BKTree tree;
+    set.inorder([&](const std::string& word) { tree.add(word); });
+
+    WordChecker checker{set};
+    EXPECT_TRUE(checker.findWordsWithinDistance("RECIEVE", 2).empty());
+
+    checker.useBKTree(tree);
+    EXPECT_EQ((std::vector<std::string>{"RECEIVE", "RECIPE"}), checker.findWordsWithinDistance("RECIEVE", 2));
+    EXPECT_EQ((std::vector<std::string>{"DECEIVE", "RECEIVE", "RECIPE"}), checker.findWordsWithinDistance("RECIEVE", 3));
+}
@@ -0,0 +1,129 @@
+// BasicWordChecker_Tests.cpp
+//
+// Unit tests covering BasicWordChecker, which finds the same suggestions
+// as WordChecker while calling its concrete Set's contains() directly.
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "AVLSet.hpp"
+#include "BasicWordChecker.hpp"
+#include "HashSet.hpp"
+#include "SkipListSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    const std::vector<std::string> WORDS{"ETH", "THE", "TEA", "TECH", "TH", "EH", "T", "E", "TE", "HE"};
+
+    const std::vector<std::string> QUERIES{"TEH", "TECHE", "TEHE", "", "THEE", "EHT", "ETH"};
+
+
+    unsigned int stringHash(const std::string& s)
+    {
+        unsigned int hash = 0;
+
+        for (char c : s)
+        {
+            hash = hash * 31 + static_cast<unsigned char>(c);
+        }
+
+        return hash;
+    }
+
+
+    template <typename SetT>
+    void expectSameSuggestions(SetT& set)
+    {
+        for (const std::string& word : WORDS)
+        {
+            set.add(word);
+        }
+
+        WordChecker checker{set};
+        BasicWordChecker<SetT> basic{set};
+
+        for (const std::string& query : QUERIES)
+        {
+            EXPECT_EQ(checker.wordExists(query), basic.wordExists(query));
+            EXPECT_EQ(checker.findSuggestions(query), basic.findSuggestions(query))
+                << "for \"" << query << "\"";
+        }
+    }
+
+
+    // CountingAVLSet counts the lookups made through its virtual
+    // contains(), which a BasicWordChecker<AVLSet<std::string>> bypasses.
+    class CountingAVLSet : public AVLSet<std::string>
+    {
+    public:
+        bool contains(const std::string& element) const override
+        {
+            lookups++;
+            return AVLSet<std::string>::contains(element);
+        }
+
+        mutable unsigned int lookups = 0;
+    };
+}
+
+
+TEST(BasicWordChecker_Tests, hashSetFindsTheSameSuggestions)
+{
+    HashSet<std::string> set{stringHash};
+    expectSameSuggestions(set);
+}
+
+
+TEST(BasicWordChecker_Tests, avlSetFindsTheSameSuggestions)
+{
+    AVLSet<std::string> set;
+    expectSameSuggestions(set);
+}
+
+
+TEST(BasicWordChecker_Tests, skipListSetFindsTheSameSuggestions)
+{
+    SkipListSet<std::string> set;
+    expectSameSuggestions(set);
+}
+
+
+TEST(BasicWordChecker_Tests, alphabetIsATemplateParameter)
+{
+    AVLSet<std::string> set;
+    for (const char* word : {"gr\xC3\xBC\xC3\x9F", "gru\xC3\x9F", "gr\xC3\xBC", "\xC3\x9F"})
+    {
+        set.add(word);
+    }
+
+    WordChecker checker{set};
+    checker.useAlphabet(SuggestionAlphabet::German);
+    BasicWordChecker<AVLSet<std::string>, GermanAlphabet> basic{set};
+
+    for (const char* query : {"gr\xC3\xBC\xC3\xB6", "gr\xC3\x9F\xC3\xBC", "gru\xC3\x9F"})
+    {
+        EXPECT_EQ(checker.findSuggestions(query), basic.findSuggestions(query));
+    }
+}
+
+
+TEST(BasicWordChecker_Tests, callsTheSetTypesOwnContains)
+{
+    CountingAVLSet set;
+    for (const std::string& word : WORDS)
+    {
+        set.add(word);
+    }
+
+    WordChecker checker{set};
+    std::vector<std::string> expected = checker.findSuggestions("TEH");
+    EXPECT_LT(0u, set.lookups);
+
+    set.lookups = 0;
+    BasicWordChecker<AVLSet<std::string>> basic{set};
+    EXPECT_EQ(expected, basic.findSuggestions("TEH"));
+    EXPECT_TRUE(basic.wordExists("THE"));
+    EXPECT_EQ(0u, set.lookups);
+}
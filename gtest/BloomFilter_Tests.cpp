@@ -0,0 +1,103 @@
+// BloomFilter_Tests.cpp
+//
+// Unit tests for BloomFilter, and for WordChecker's use of one in front
+// of its Set.
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "AVLSet.hpp"
+#include "BloomFilter.hpp"
+#include "WordChecker.hpp"
+
+
+TEST(BloomFilter_Tests, isSizedFromExpectedElementsAndRate)
+{
+    BloomFilter filter{1000, 0.01};
+
+    // About 9.6 bits and 7 hashes per element for a 1% rate.
+    EXPECT_NEAR(9585, static_cast<double>(filter.bitCount()), 64);
+    EXPECT_EQ(7, filter.hashCount());
+}
+
+
+TEST(BloomFilter_Tests, neverRejectsAddedElements)
+{
+    BloomFilter filter{5000, 0.01};
+
+    for (unsigned int i = 0; i < 5000; ++i)
+    {
+        filter.add("WORD" + std::to_string(i));
+    }
+
+    for (unsigned int i = 0; i < 5000; ++i)
+    {
+        EXPECT_TRUE(filter.mightContain("WORD" + std::to_string(i)));
+    }
+}
+
+
+TEST(BloomFilter_Tests, falsePositiveRateIsCloseToTarget)
+{
+    BloomFilter filter{10000, 0.01};
+
+    for (unsigned int i = 0; i < 10000; ++i)
+    {
+        filter.add("WORD" + std::to_string(i));
+    }
+
+    unsigned int falsePositives = 0;
+    for (unsigned int i = 0; i < 100000; ++i)
+    {
+        falsePositives += filter.mightContain("OTHER" + std::to_string(i)) ? 1 : 0;
+    }
+
+    EXPECT_LT(falsePositives, 2000u);
+}
+
+
+TEST(BloomFilter_Tests, wordCheckerCountsRejectedAndPassedLookups)
+{
+    AVLSet<std::string> set;
+    BloomFilter filter{100, 0.001};
+
+    for (const char* word : {"THE", "CAT", "SAT"})
+    {
+        set.add(word);
+        filter.add(word);
+    }
+
+    WordChecker checker{set};
+    checker.useBloomFilter(filter, true);
+
+    EXPECT_TRUE(checker.wordExists("CAT"));
+    EXPECT_FALSE(checker.wordExists("DOG"));
+    EXPECT_EQ((std::vector<std::string>{"THE"}), checker.findSuggestions("TEH"));
+
+    BloomFilterStats stats = checker.bloomFilterStats();
+    EXPECT_GE(stats.passed, 2u);
+    EXPECT_GT(stats.rejected, 100u);
+    EXPECT_EQ(stats.passed - 2, stats.falsePositives);
+
+    checker.resetBloomFilterStats();
+    EXPECT_EQ(0u, checker.bloomFilterStats().rejected);
+}
+
+
+TEST(BloomFilter_Tests, wordCheckerOnlyCountsLookupsWhenAsked)
+{
+    AVLSet<std::string> set;
+    BloomFilter filter{100, 0.001};
+    set.add("THE");
+    filter.add("THE");
+
+    WordChecker checker{set};
+    checker.useBloomFilter(filter);
+
+    EXPECT_EQ((std::vector<std::string>{"THE"}), checker.findSuggestions("TEH"));
+
+    BloomFilterStats stats = checker.bloomFilterStats();
+    EXPECT_EQ(0u, stats.rejected);
+    EXPECT_EQ(0u, stats.passed);
+    EXPECT_EQ(0u, stats.falsePositives);
+}
@@ -0,0 +1,165 @@
+// CorpusChecker_Tests.cpp
+//
+// Unit tests for WorkStealingPool and for CorpusChecker, which checks
+// chunks of many files in parallel and reports the results in order.
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+#include "AVLSet.hpp"
+#include "CorpusChecker.hpp"
+#include "DocumentChecker.hpp"
+#include "WordChecker.hpp"
+#include "WorkStealingPool.hpp"
+
+
+TEST(CorpusChecker_Tests, poolRunsEveryTaskExactlyOnce)
+{
+    std::vector<std::atomic<int>> runs(1000);
+
+    for (unsigned int threads : {1u, 3u, 8u})
+    {
+        for (std::atomic<int>& r : runs)
+        {
+            r = 0;
+        }
+
+        WorkStealingPool pool{threads};
+        pool.run(runs.size(), [&](unsigned int task) { runs[task]++; });
+
+        for (const std::atomic<int>& r : runs)
+        {
+            ASSERT_EQ(1, r);
+        }
+    }
+}
+
+
+TEST(CorpusChecker_Tests, poolRethrowsTaskExceptions)
+{
+    WorkStealingPool pool{4};
+
+    EXPECT_THROW(
+        pool.run(100, [](unsigned int task) { if (task == 42) throw std::runtime_error{"boom"}; }),
+        std::runtime_error);
+}
+
+
+TEST(CorpusChecker_Tests, chunkBoundariesFallBetweenWords)
+{
+    std::string text = "THE CAT'S HAT   SAT ON A MAT";
+    std::vector<std::size_t> boundaries = CorpusChecker::chunkBoundaries(text, 5);
+
+    ASSERT_EQ(0u, boundaries.front());
+    ASSERT_EQ(text.size(), boundaries.back());
+
+    std::vector<std::string> words;
+    for (std::size_t b = 0; b + 1 < boundaries.size(); ++b)
+    {
+        EXPECT_LT(boundaries[b], boundaries[b + 1]);
+        DocumentChecker::forEachWord(
+            std::string_view{text}.substr(boundaries[b], boundaries[b + 1] - boundaries[b]),
+            [&](std::size_t, std::string_view word) { words.emplace_back(word); });
+    }
+
+    EXPECT_EQ((std::vector<std::string>{"THE", "CAT'S", "HAT", "SAT", "ON", "A", "MAT"}), words);
+}
+
+
+TEST(CorpusChecker_Tests, reportsSameMisspellingsInSameOrderAsSequentialChecking)
+{
+    AVLSet<std::string> set;
+    for (const char* word : {"THE", "CAT", "SAT", "ON", "MAT", "A", "HAT"})
+    {
+        set.add(word);
+    }
+
+    std::vector<std::string> paths;
+    for (unsigned int f = 0; f < 3; ++f)
+    {
+        std::filesystem::path path = std::filesystem::temp_directory_path()
+            / ("CorpusChecker_Tests" + std::to_string(f) + ".txt");
+        std::ofstream out{path, std::ios::binary};
+
+        for (unsigned int i = 0; i < 400; ++i)
+        {
+            out << (i % 7 == f ? "TEH " : "THE ") << (i % 11 == 0 ? "CTA\n" : "CAT\n") << "SAT ON A MAT ";
+        }
+
+        paths.push_back(path.string());
+    }
+
+    WordChecker checker{set};
+    DocumentChecker document{checker};
+
+    using Found = std::tuple<unsigned int, std::size_t, std::string, std::vector<std::string>>;
+    std::vector<Found> expected;
+    unsigned long long expectedWords = 0;
+    for (unsigned int f = 0; f < paths.size(); ++f)
+    {
+        expectedWords += document.checkFile(paths[f], [&](const Misspelling& m)
+        {
+            expected.emplace_back(f, m.offset, std::string{m.word}, m.suggestions);
+        });
+    }
+
+    for (unsigned int threads : {1u, 4u})
+    {
+        for (std::size_t chunkSize : {7u, 100u, 1u << 20})
+        {
+            CorpusChecker corpus{checker, threads, chunkSize};
+            std::vector<Found> found;
+
+            unsigned long long words = corpus.checkFiles(paths, [&](unsigned int f, const Misspelling& m)
+            {
+                found.emplace_back(f, m.offset, std::string{m.word}, m.suggestions);
+            });
+
+            EXPECT_EQ(expectedWords, words);
+            EXPECT_EQ(expected, found);
+        }
+    }
+
+    for (const std::string& path : paths)
+    {
+        std::filesystem::remove(path);
+    }
+}
+
+
+TEST(CorpusChecker_Tests, rethrowsExceptionsFromTheVisitFunction)
+{
+    AVLSet<std::string> set;
+    set.add("THE");
+
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "CorpusChecker_TestsThrow.txt";
+    {
+        std::ofstream out{path, std::ios::binary};
+        for (unsigned int i = 0; i < 200; ++i)
+        {
+            out << "THE TEH ";
+        }
+    }
+
+    WordChecker checker{set};
+    CorpusChecker corpus{checker, 4, 16, false};
+    unsigned int visits = 0;
+
+    EXPECT_THROW(
+        corpus.checkFiles({path.string()}, [&](unsigned int, const Misspelling&)
+        {
+            if (++visits == 10)
+            {
+                throw std::runtime_error{"stop"};
+            }
+        }),
+        std::runtime_error);
+    EXPECT_EQ(10u, visits);
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,94 @@
+// DeletionIndex_Tests.cpp
+//
+// Unit tests for DeletionIndex, including a check that it suggests exactly
+// what WordChecker does when built for an edit distance of 1.
+
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "DeletionIndex.hpp"
+#include "HashSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    unsigned int stringHash(const std::string& s)
+    {
+        unsigned int hash = 0;
+
+        for (char c : s)
+        {
+            hash = hash * 31 + static_cast<unsigned char>(c);
+        }
+
+        return hash;
+    }
+
+
+    std::string randomWord(std::mt19937& rng, unsigned int maxLength)
+    {
+        // A small alphabet makes words collide often enough that every
+        // technique gets exercised.
+        std::string word(1 + rng() % maxLength, ' ');
+
+        for (char& c : word)
+        {
+            c = "ABCDEa"[rng() % 6];
+        }
+
+        return word;
+    }
+}
+
+
+TEST(DeletionIndex_Tests, containsAddedWords)
+{
+    DeletionIndex index;
+    index.add("HELLO");
+    index.add("THERE");
+    index.add("HELLO");
+
+    EXPECT_TRUE(index.contains("HELLO"));
+    EXPECT_TRUE(index.contains("THERE"));
+    EXPECT_FALSE(index.contains("HELL"));
+    EXPECT_EQ(2, index.size());
+    EXPECT_EQ(1, index.maxDistance());
+}
+
+
+TEST(DeletionIndex_Tests, matchesWordCheckerAtDistanceOne)
+{
+    std::mt19937 rng{46};
+    HashSet<std::string> set{stringHash};
+    DeletionIndex index;
+
+    for (unsigned int i = 0; i < 2000; ++i)
+    {
+        std::string word = randomWord(rng, 6);
+        set.add(word);
+        index.add(word);
+    }
+
+    WordChecker checker{set};
+
+    for (unsigned int i = 0; i < 2000; ++i)
+    {
+        std::string word = randomWord(rng, 7);
+        ASSERT_EQ(checker.findSuggestions(word), index.findSuggestions(word)) << word;
+    }
+}
+
+
+TEST(DeletionIndex_Tests, findsWordsTwoEditsAwayAtDistanceTwo)
+{
+    DeletionIndex index{2};
+    index.add("RECEIVE");
+    index.add("BELIEVE");
+    index.add("RECIPE");
+
+    EXPECT_EQ((std::vector<std::string>{"BELIEVE", "RECEIVE", "RECIPE"}), index.findSuggestions("RECIEVE"));
+    EXPECT_EQ((std::vector<std::string>{"RECEIVE"}), index.findSuggestions("RCEIEVE"));
+    EXPECT_TRUE(index.findSuggestions("XXXXXXX").empty());
+}
@@ -0,0 +1,123 @@
+// DocumentChecker_Tests.cpp
+//
+// Unit tests for DocumentChecker, which checks every word of a document
+// (from a string or a memory-mapped file) with a WordChecker.
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include "AVLSet.hpp"
+#include "DocumentChecker.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    AVLSet<std::string> makeDictionary()
+    {
+        AVLSet<std::string> set;
+
+        for (const char* word : {"THE", "CAT", "SAT", "ON", "MAT", "DON'T"})
+        {
+            set.add(word);
+        }
+
+        return set;
+    }
+}
+
+
+TEST(DocumentChecker_Tests, splitsTextIntoWords)
+{
+    std::vector<std::pair<std::size_t, std::string>> words;
+
+    DocumentChecker::forEachWord("  THE cat's 'quoted' 42 X-RAY\xc3\xa9t\xc3\xa9 DON'T'",
+        [&](std::size_t offset, std::string_view word) { words.emplace_back(offset, std::string{word}); });
+
+    std::vector<std::pair<std::size_t, std::string>> expected{
+        {2, "THE"}, {6, "cat's"}, {13, "quoted"}, {24, "X"}, {26, "RAY\xc3\xa9t\xc3\xa9"}, {35, "DON'T"}};
+    EXPECT_EQ(expected, words);
+}
+
+
+TEST(DocumentChecker_Tests, reportsMisspellingsWithOffsetsAndSuggestions)
+{
+    AVLSet<std::string> set = makeDictionary();
+    WordChecker checker{set};
+    DocumentChecker document{checker};
+
+    std::vector<Misspelling> found;
+    unsigned long long words = document.checkText("THE CTA SAT ON TEH MAT",
+        [&](const Misspelling& m) { found.push_back(m); }, 100);
+
+    EXPECT_EQ(6u, words);
+    ASSERT_EQ(2u, found.size());
+    EXPECT_EQ(104u, found[0].offset);
+    EXPECT_EQ("CTA", found[0].word);
+    EXPECT_EQ((std::vector<std::string>{"CAT"}), found[0].suggestions);
+    EXPECT_EQ(115u, found[1].offset);
+    EXPECT_EQ("TEH", found[1].word);
+    EXPECT_EQ((std::vector<std::string>{"THE"}), found[1].suggestions);
+}
+
+
+TEST(DocumentChecker_Tests, checksMemoryMappedFiles)
+{
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "DocumentChecker_Tests.txt";
+    {
+        std::ofstream out{path, std::ios::binary};
+        out << "THE CAT\nSTA ON\nTHE MTA DON'T\n";
+    }
+
+    AVLSet<std::string> set = makeDictionary();
+    WordChecker checker{set};
+    DocumentChecker document{checker, false};
+
+    std::vector<std::pair<std::size_t, std::string>> found;
+    unsigned long long words = document.checkFile(path.string(),
+        [&](const Misspelling& m) { found.emplace_back(m.offset, std::string{m.word}); });
+
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(7u, words);
+    std::vector<std::pair<std::size_t, std::string>> expected{{8, "STA"}, {19, "MTA"}};
+    EXPECT_EQ(expected, found);
+}
+
+
+TEST(DocumentChecker_Tests, throwsWhenFileCannotBeOpened)
+{
+    AVLSet<std::string> set = makeDictionary();
+    WordChecker checker{set};
+    DocumentChecker document{checker};
+
+    EXPECT_THROW(
+        document.checkFile("/nonexistent/DocumentChecker_Tests.txt", [](const Misspelling&) { }),
+        DocumentCheckerException);
+}
+
+
+TEST(DocumentChecker_Tests, uppercasesWordsBeforeLookingThemUp)
+{
+    AVLSet<std::string> set = makeDictionary();
+    WordChecker checker{set};
+
+    std::vector<Misspelling> found;
+    auto collect = [&](const Misspelling& m) { found.push_back(m); };
+
+    EXPECT_EQ(4u, DocumentChecker{checker}.checkText("The cta Don't mat", collect));
+    ASSERT_EQ(1u, found.size());
+    EXPECT_EQ("cta", found[0].word);
+    EXPECT_EQ((std::vector<std::string>{"CAT"}), found[0].suggestions);
+
+    found.clear();
+    DocumentChecker{checker, false, WordCase::AsWritten}.checkText("The CAT mat", collect);
+    ASSERT_EQ(2u, found.size());
+    EXPECT_EQ("The", found[0].word);
+    EXPECT_EQ("mat", found[1].word);
+}
@@ -0,0 +1,112 @@
+// EditDistance_Tests.cpp
+//
+// Unit tests for the edit distance functions, and for BitParallelDistance,
+// which must always agree with them.
+
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "EditDistance.hpp"
+
+
+namespace
+{
+    std::string randomWord(std::mt19937& rng, unsigned int maxLength)
+    {
+        std::string word(rng() % (maxLength + 1), ' ');
+
+        // Only a few letters are used, so that the words share plenty of
+        // characters and swaps.
+        for (char& c : word)
+        {
+            c = static_cast<char>('A' + rng() % 4);
+        }
+
+        return word;
+    }
+}
+
+
+TEST(EditDistance_Tests, measuresKnownDistances)
+{
+    EXPECT_EQ(3u, levenshteinDistance("KITTEN", "SITTING"));
+    EXPECT_EQ(2u, levenshteinDistance("TEH", "THE"));
+    EXPECT_EQ(1u, damerauDistance("TEH", "THE"));
+    EXPECT_EQ(3u, damerauDistance("CA", "ABC"));
+
+    BitParallelDistance kitten{"KITTEN"};
+    EXPECT_EQ(3u, kitten.levenshtein("SITTING"));
+    EXPECT_EQ(0u, kitten.damerau("KITTEN"));
+    EXPECT_EQ(6u, kitten.levenshtein(""));
+    EXPECT_EQ(1u, BitParallelDistance{"TEH"}.damerau("THE"));
+    EXPECT_EQ(3u, BitParallelDistance{"CA"}.damerau("ABC"));
+    EXPECT_EQ(4u, BitParallelDistance{""}.levenshtein("ABCD"));
+}
+
+
+TEST(EditDistance_Tests, bitParallelDistancesMatchDynamicProgramming)
+{
+    std::mt19937 rng{46};
+
+    for (unsigned int i = 0; i < 20000; ++i)
+    {
+        std::string a = randomWord(rng, 12);
+        std::string b = randomWord(rng, 12);
+        BitParallelDistance fromA{a};
+
+        ASSERT_EQ(levenshteinDistance(a, b), fromA.levenshtein(b)) << a << " " << b;
+        ASSERT_EQ(damerauDistance(a, b), fromA.damerau(b)) << a << " " << b;
+    }
+}
+
+
+TEST(EditDistance_Tests, handlesWordsAroundSixtyFourBytes)
+{
+    std::mt19937 rng{64};
+
+    for (unsigned int i = 0; i < 2000; ++i)
+    {
+        std::string a = randomWord(rng, 80);
+        std::string b = randomWord(rng, 80);
+        BitParallelDistance fromA{a};
+
+        ASSERT_EQ(levenshteinDistance(a, b), fromA.levenshtein(b)) << a << " " << b;
+        ASSERT_EQ(damerauDistance(a, b), fromA.damerau(b)) << a << " " << b;
+    }
+}
+
+
+TEST(EditDistance_Tests, batchesMatchSingleDistances)
+{
+    std::mt19937 rng{4};
+
+    for (unsigned int i = 0; i < 500; ++i)
+    {
+        BitParallelDistance fromA{randomWord(rng, 12)};
+
+        // The count is often not a multiple of LANES, and the words' lengths
+        // differ, so some lanes run out before others.
+        std::vector<std::string> others;
+        std::vector<const std::string*> pointers;
+        for (unsigned int j = rng() % 11; j > 0; --j)
+        {
+            others.push_back(randomWord(rng, 12));
+        }
+        for (const std::string& other : others)
+        {
+            pointers.push_back(&other);
+        }
+
+        std::vector<unsigned int> levenshtein(others.size());
+        std::vector<unsigned int> damerau(others.size());
+        fromA.levenshtein(pointers.data(), pointers.size(), levenshtein.data());
+        fromA.damerau(pointers.data(), pointers.size(), damerau.data());
+
+        for (std::size_t j = 0; j < others.size(); ++j)
+        {
+            ASSERT_EQ(fromA.levenshtein(others[j]), levenshtein[j]);
+            ASSERT_EQ(fromA.damerau(others[j]), damerau[j]);
+        }
+    }
+}
@@ -0,0 +1,230 @@
+// FlatHashSet_Tests.cpp
+//
+// Unit tests covering FlatHashSet, the open-addressing alternative to
+// HashSet, including its probe statistics.
+
+#include <string>
+#include <gtest/gtest.h>
+#include "BasicWordChecker.hpp"
+#include "FlatHashSet.hpp"
+#include "HashSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    template <typename T>
+    unsigned int zeroHash(const T&)
+    {
+        return 0;
+    }
+
+
+    unsigned int identityHash(const int& i)
+    {
+        return static_cast<unsigned int>(i);
+    }
+
+
+    unsigned int stringHash(const std::string& s)
+    {
+        unsigned int hash = 2166136261u;
+        for (char c : s)
+        {
+            hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+        }
+        return hash;
+    }
+}
+
+
+TEST(FlatHashSet_Tests, inheritFromSet)
+{
+    FlatHashSet<std::string> s{stringHash};
+    Set<std::string>& ss = s;
+
+    EXPECT_TRUE(ss.isImplemented());
+    EXPECT_EQ(0u, ss.size());
+}
+
+
+TEST(FlatHashSet_Tests, containsOnlyWhatWasAdded)
+{
+    FlatHashSet<std::string> s{stringHash};
+    s.add("THE");
+    s.add("ETH");
+    s.add("THE");
+
+    EXPECT_EQ(2u, s.size());
+    EXPECT_TRUE(s.contains("THE"));
+    EXPECT_TRUE(s.contains("ETH"));
+    EXPECT_FALSE(s.contains("HTE"));
+    EXPECT_FALSE(s.contains(""));
+}
+
+
+TEST(FlatHashSet_Tests, growsByDoublingItsGroups)
+{
+    FlatHashSet<int> s{identityHash};
+    EXPECT_EQ(1u, s.groupCount());
+
+    for (int i = 0; i < 14; ++i)
+    {
+        s.add(i);
+    }
+    EXPECT_EQ(1u, s.groupCount());
+
+    s.add(14);
+    EXPECT_EQ(2u, s.groupCount());
+
+    for (int i = 15; i < 10000; ++i)
+    {
+        s.add(i);
+    }
+
+    EXPECT_EQ(10000u, s.size());
+    EXPECT_EQ(1024u, s.groupCount());
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        ASSERT_TRUE(s.contains(i));
+    }
+    EXPECT_FALSE(s.contains(-1));
+    EXPECT_FALSE(s.contains(10000));
+}
+
+
+TEST(FlatHashSet_Tests, elementsInGroupsAddUpToTheSize)
+{
+    FlatHashSet<int> s{identityHash};
+    for (int i = 0; i < 1000; ++i)
+    {
+        s.add(i * 7);
+    }
+
+    unsigned int total = 0;
+    for (unsigned int group = 0; group < s.groupCount(); ++group)
+    {
+        EXPECT_LE(s.elementsInGroup(group), FlatHashSet<int>::GROUP_WIDTH);
+        total += s.elementsInGroup(group);
+    }
+
+    EXPECT_EQ(1000u, total);
+    EXPECT_EQ(0u, s.elementsInGroup(s.groupCount()));
+}
+
+
+TEST(FlatHashSet_Tests, collidingElementsProbeFurtherGroups)
+{
+    FlatHashSet<std::string> s{zeroHash<std::string>};
+    for (int i = 0; i < 100; ++i)
+    {
+        s.add(std::to_string(i));
+    }
+
+    EXPECT_EQ(100u, s.size());
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(s.contains(std::to_string(i)));
+    }
+
+    EXPECT_EQ(1u, s.groupsProbed("0"));
+    EXPECT_GT(s.groupsProbed("99"), 1u);
+    EXPECT_EQ(7u, s.groupsProbed("missing"));
+    EXPECT_FALSE(s.contains("missing"));
+}
+
+
+TEST(FlatHashSet_Tests, missesUsuallyProbeOneGroup)
+{
+    FlatHashSet<std::string> s{stringHash};
+    for (int i = 0; i < 5000; ++i)
+    {
+        s.add("WORD" + std::to_string(i));
+    }
+
+    unsigned int probed = 0;
+    for (int i = 0; i < 1000; ++i)
+    {
+        probed += s.groupsProbed("MISS" + std::to_string(i));
+    }
+
+    EXPECT_LT(probed, 1100u);
+}
+
+
+TEST(FlatHashSet_Tests, copiesAreIndependent)
+{
+    FlatHashSet<std::string> s{stringHash};
+    for (int i = 0; i < 50; ++i)
+    {
+        s.add(std::to_string(i));
+    }
+
+    FlatHashSet<std::string> copy{s};
+    copy.add("copy");
+
+    FlatHashSet<std::string> assigned{zeroHash<std::string>};
+    assigned.add("assigned");
+    assigned = s;
+    s.add("original");
+
+    EXPECT_EQ(51u, copy.size());
+    EXPECT_EQ(50u, assigned.size());
+    EXPECT_EQ(51u, s.size());
+    EXPECT_TRUE(copy.contains("49"));
+    EXPECT_TRUE(assigned.contains("49"));
+    EXPECT_FALSE(assigned.contains("assigned"));
+    EXPECT_FALSE(s.contains("copy"));
+    EXPECT_FALSE(copy.contains("original"));
+}
+
+
+TEST(FlatHashSet_Tests, movesLeaveAnEmptySetWithoutGroups)
+{
+    FlatHashSet<std::string> s{stringHash};
+    s.add("THE");
+
+    FlatHashSet<std::string> moved{std::move(s)};
+    EXPECT_TRUE(moved.contains("THE"));
+    EXPECT_EQ(0u, s.size());
+    EXPECT_EQ(0u, s.groupCount());
+    EXPECT_FALSE(s.contains("THE"));
+    EXPECT_EQ(0u, s.elementsInGroup(0));
+    EXPECT_EQ(0u, s.groupsProbed("THE"));
+
+    FlatHashSet<std::string> copy{s};
+    EXPECT_EQ(0u, copy.size());
+
+    s = FlatHashSet<std::string>{stringHash};
+    s.add("ETH");
+    EXPECT_TRUE(s.contains("ETH"));
+    EXPECT_FALSE(s.contains("THE"));
+
+    FlatHashSet<std::string> assigned{stringHash};
+    assigned = std::move(moved);
+    EXPECT_EQ(1u, assigned.size());
+    EXPECT_TRUE(assigned.contains("THE"));
+}
+
+
+TEST(FlatHashSet_Tests, findsTheSameSuggestionsAsHashSet)
+{
+    HashSet<std::string> hashSet{stringHash};
+    FlatHashSet<std::string> flatSet{stringHash};
+    for (const char* word : {"THE", "THEM", "THEN", "TEN", "HE", "EH", "THERE"})
+    {
+        hashSet.add(word);
+        flatSet.add(word);
+    }
+
+    WordChecker hashChecker{hashSet};
+    WordChecker flatChecker{flatSet};
+    BasicWordChecker<FlatHashSet<std::string>> staticChecker{flatSet};
+
+    for (const char* word : {"TEH", "THEE", "THM", "THEHE", "XYZ"})
+    {
+        EXPECT_EQ(hashChecker.findSuggestions(word), flatChecker.findSuggestions(word));
+        EXPECT_EQ(hashChecker.findSuggestions(word), staticChecker.findSuggestions(word));
+    }
+}
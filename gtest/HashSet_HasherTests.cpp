@@ -0,0 +1,154 @@
+// HashSet_HasherTests.cpp
+//
+// Unit tests covering HashSets whose hash function is a template
+// parameter, and the std::string_view lookups a transparent one allows.
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <gtest/gtest.h>
+#include "BasicWordChecker.hpp"
+#include "FnvHash.hpp"
+#include "HashSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    unsigned int identityHash(const int& i)
+    {
+        return static_cast<unsigned int>(i);
+    }
+
+
+    template <typename SetT, typename = void>
+    struct LooksUpViews : std::false_type
+    {
+    };
+
+
+    template <typename SetT>
+    struct LooksUpViews<SetT, std::void_t<decltype(std::declval<const SetT&>().contains(std::string_view{}))>>
+        : std::true_type
+    {
+    };
+}
+
+
+TEST(HashSet_HasherTests, fnvHashIsTheSameForStringsAndViews)
+{
+    FnvHash hash;
+    std::string word{"SPELLING"};
+
+    EXPECT_EQ(2166136261u, hash(""));
+    EXPECT_EQ(0xE40C292Cu, hash("a"));
+    EXPECT_EQ(hash(word), hash(std::string_view{word}));
+    EXPECT_EQ(hash("SPELL"), hash(std::string_view{word}.substr(0, 5)));
+}
+
+
+TEST(HashSet_HasherTests, canUseAFunctionPointerType)
+{
+    HashSet<int, unsigned int (*)(const int&)> s{identityHash};
+    for (int i = 0; i < 100; ++i)
+    {
+        s.add(i);
+    }
+
+    EXPECT_EQ(100u, s.size());
+    EXPECT_TRUE(s.contains(99));
+    EXPECT_FALSE(s.contains(100));
+    EXPECT_EQ(1u, s.elementsAtIndex(5));
+}
+
+
+TEST(HashSet_HasherTests, looksUpViewsWithoutCopyingThem)
+{
+    HashSet<std::string, FnvHash> s{FnvHash{}};
+    s.add("THE");
+    s.add("THEN");
+
+    std::string_view buffer{"XTHENX"};
+
+    EXPECT_TRUE(s.contains(buffer.substr(1, 3)));
+    EXPECT_TRUE(s.contains(buffer.substr(1, 4)));
+    EXPECT_FALSE(s.contains(buffer.substr(1, 5)));
+    EXPECT_FALSE(s.contains(buffer.substr(0, 4)));
+    EXPECT_TRUE(s.contains("THE"));
+    EXPECT_TRUE(s.contains(std::string{"THEN"}));
+}
+
+
+TEST(HashSet_HasherTests, onlyTransparentHashersLookUpViews)
+{
+    EXPECT_TRUE((LooksUpViews<HashSet<std::string, FnvHash>>::value));
+    EXPECT_FALSE((LooksUpViews<HashSet<std::string>>::value));
+    EXPECT_FALSE((LooksUpViews<HashSet<int, FnvHash>>::value));
+}
+
+
+TEST(HashSet_HasherTests, copiesAndMovesKeepTheHasher)
+{
+    HashSet<std::string, FnvHash> s{FnvHash{}};
+    for (int i = 0; i < 50; ++i)
+    {
+        s.add(std::to_string(i));
+    }
+
+    HashSet<std::string, FnvHash> copy{s};
+    HashSet<std::string, FnvHash> moved{std::move(s)};
+    s.add("again");
+
+    EXPECT_EQ(50u, copy.size());
+    EXPECT_EQ(50u, moved.size());
+    EXPECT_TRUE(copy.contains(std::string_view{"49"}));
+    EXPECT_TRUE(moved.contains(std::string_view{"49"}));
+    EXPECT_TRUE(s.contains("again"));
+}
+
+
+TEST(HashSet_HasherTests, movedFromSetsAreEmptyUntilAssigned)
+{
+    auto hash = [](const std::string& s) { return FnvHash{}(s); };
+    HashSet<std::string> s{hash};
+    s.add("THE");
+
+    HashSet<std::string> moved{std::move(s)};
+    EXPECT_TRUE(moved.contains("THE"));
+
+    // s has no array and no hash function left, but can still be searched
+    // and copied without either.
+    EXPECT_EQ(0u, s.size());
+    EXPECT_FALSE(s.contains("THE"));
+    EXPECT_EQ(0u, s.elementsAtIndex(0));
+    EXPECT_FALSE(s.isElementAtIndex("THE", 0));
+
+    HashSet<std::string> copy{s};
+    EXPECT_EQ(0u, copy.size());
+    EXPECT_FALSE(copy.contains("THE"));
+
+    s = HashSet<std::string>{hash};
+    s.add("AGAIN");
+    EXPECT_TRUE(s.contains("AGAIN"));
+    EXPECT_EQ(1u, s.size());
+}
+
+
+TEST(HashSet_HasherTests, findsTheSameSuggestionsWithEitherHasher)
+{
+    HashSet<std::string> functionSet{[](const std::string& s) { return FnvHash{}(s); }};
+    HashSet<std::string, FnvHash> fnvSet{FnvHash{}};
+    for (const char* word : {"THE", "THEM", "THEN", "TEN", "HE", "EH", "QUICK", "BROWN", "FOX"})
+    {
+        functionSet.add(word);
+        fnvSet.add(word);
+    }
+
+    WordChecker checker{functionSet};
+    BasicWordChecker<HashSet<std::string, FnvHash>> fnvChecker{fnvSet};
+
+    for (const char* word : {"TEH", "THEE", "THEHE", "THEQUICKBROWNFOX", "XYZ"})
+    {
+        EXPECT_EQ(checker.findSuggestions(word), fnvChecker.findSuggestions(word));
+    }
+}
@@ -0,0 +1,251 @@
+// HashSet_IncrementalRehashTests.cpp
+//
+// Unit tests covering how a HashSet grows: a few buckets at a time, by
+// relinking its nodes, with lookups, copies and the per-index counts
+// seeing every element while some are still in the old array.
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <gtest/gtest.h>
+#include "FnvHash.hpp"
+#include "HashSet.hpp"
+
+
+namespace
+{
+    unsigned int identityHash(const int& i)
+    {
+        return static_cast<unsigned int>(i);
+    }
+
+
+    struct CountingHash
+    {
+        unsigned long long* calls;
+
+        unsigned int operator()(const int& i) const
+        {
+            ++*calls;
+            return static_cast<unsigned int>(i);
+        }
+    };
+
+
+    // A CountedCopy counts how many times any CountedCopy has been copied.
+    struct CountedCopy
+    {
+        static inline unsigned int copies = 0;
+
+        int value = 0;
+
+        CountedCopy() = default;
+
+        CountedCopy(int value)
+            : value{value}
+        {
+        }
+
+        CountedCopy(const CountedCopy& other)
+            : value{other.value}
+        {
+            ++copies;
+        }
+
+        CountedCopy& operator=(const CountedCopy& other)
+        {
+            value = other.value;
+            ++copies;
+            return *this;
+        }
+
+        bool operator==(const CountedCopy& other) const
+        {
+            return value == other.value;
+        }
+    };
+
+
+    unsigned int countedCopyHash(const CountedCopy& c)
+    {
+        return static_cast<unsigned int>(c.value);
+    }
+
+
+    // With the default capacity of 10, the eighth element makes the set
+    // grow to 21 buckets, and all eight are left in the old array; 3 and
+    // 13 share bucket 3 there, but belong at indexes 3 and 13 now.
+    HashSet<int> makeGrowingSet()
+    {
+        HashSet<int> s{identityHash};
+        for (int i : {3, 13, 0, 1, 2, 4, 5, 6})
+        {
+            s.add(i);
+        }
+        return s;
+    }
+}
+
+
+TEST(HashSet_IncrementalRehashTests, elementsAreFoundWhileTheSetGrows)
+{
+    HashSet<int> s{identityHash};
+
+    for (int i = 0; i < 600; ++i)
+    {
+        s.add(i * 11);
+
+        for (int j = 0; j <= i; ++j)
+        {
+            ASSERT_TRUE(s.contains(j * 11)) << "after adding " << i * 11;
+        }
+        ASSERT_FALSE(s.contains(i * 11 + 1));
+    }
+
+    EXPECT_EQ(600, s.size());
+}
+
+
+TEST(HashSet_IncrementalRehashTests, indexesAreInTheNewArrayWhileGrowing)
+{
+    HashSet<int> s = makeGrowingSet();
+
+    EXPECT_EQ(8, s.size());
+    EXPECT_EQ(1, s.elementsAtIndex(3));
+    EXPECT_EQ(1, s.elementsAtIndex(13));
+    EXPECT_EQ(0, s.elementsAtIndex(21));
+    EXPECT_TRUE(s.isElementAtIndex(13, 13));
+    EXPECT_FALSE(s.isElementAtIndex(13, 3));
+    EXPECT_FALSE(s.isElementAtIndex(7, 7));
+
+    unsigned int total = 0;
+    for (unsigned int index = 0; index < 21; ++index)
+    {
+        total += s.elementsAtIndex(index);
+    }
+    EXPECT_EQ(8u, total);
+}
+
+
+TEST(HashSet_IncrementalRehashTests, noAddMovesEveryElement)
+{
+    unsigned long long calls = 0;
+    HashSet<int, CountingHash> s{CountingHash{&calls}};
+
+    // Consecutive ints never share a bucket, so each add() hashes the new
+    // element once, plus once for each element in the two or so buckets
+    // it moves (three right after the first growth, when the 10 old
+    // buckets are spread over only 9 adds).
+    unsigned long long mostCalls = 0;
+    for (int i = 0; i < 100000; ++i)
+    {
+        unsigned long long before = calls;
+        s.add(i);
+        mostCalls = std::max(mostCalls, calls - before);
+    }
+
+    EXPECT_EQ(100000, s.size());
+    EXPECT_LE(mostCalls, 3u);
+}
+
+
+TEST(HashSet_IncrementalRehashTests, growingFinishesBeforeGrowingAgain)
+{
+    unsigned long long calls = 0;
+    HashSet<int, CountingHash> s{CountingHash{&calls}};
+
+    // If a growth step ever started before the last one had finished, the
+    // add() that started it would move every bucket still left.
+    for (int i = 0; i < 100000; ++i)
+    {
+        unsigned long long before = calls;
+        s.add(i * 7919);
+        ASSERT_LE(calls - before, 8u) << "adding " << i * 7919;
+    }
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        ASSERT_TRUE(s.contains(i * 7919));
+    }
+}
+
+
+TEST(HashSet_IncrementalRehashTests, growingNeverCopiesElements)
+{
+    HashSet<CountedCopy> s{countedCopyHash};
+    CountedCopy::copies = 0;
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        s.add(CountedCopy{i});
+    }
+
+    EXPECT_EQ(10000, s.size());
+    EXPECT_EQ(10000u, CountedCopy::copies);
+    EXPECT_TRUE(s.contains(CountedCopy{0}));
+    EXPECT_TRUE(s.contains(CountedCopy{9999}));
+}
+
+
+TEST(HashSet_IncrementalRehashTests, copiesWhileGrowingHaveEveryElement)
+{
+    HashSet<int> s = makeGrowingSet();
+
+    HashSet<int> copy{s};
+    HashSet<int> assigned{identityHash};
+    assigned.add(100);
+    assigned = s;
+
+    s.add(7);
+
+    for (int i : {3, 13, 0, 1, 2, 4, 5, 6})
+    {
+        EXPECT_TRUE(copy.contains(i));
+        EXPECT_TRUE(assigned.contains(i));
+    }
+    EXPECT_FALSE(copy.contains(7));
+    EXPECT_FALSE(assigned.contains(100));
+    EXPECT_EQ(1, copy.elementsAtIndex(13));
+    EXPECT_EQ(1, assigned.elementsAtIndex(3));
+}
+
+
+TEST(HashSet_IncrementalRehashTests, movesWhileGrowingTakeTheOldArray)
+{
+    HashSet<int> s = makeGrowingSet();
+
+    HashSet<int> moved{std::move(s)};
+    HashSet<int> assigned{identityHash};
+    assigned = std::move(moved);
+
+    EXPECT_EQ(8, assigned.size());
+    EXPECT_TRUE(assigned.contains(13));
+    EXPECT_TRUE(assigned.isElementAtIndex(13, 13));
+
+    for (int i = 100; i < 200; ++i)
+    {
+        assigned.add(i);
+    }
+    EXPECT_TRUE(assigned.contains(13));
+    EXPECT_EQ(108, assigned.size());
+}
+
+
+TEST(HashSet_IncrementalRehashTests, viewsAreFoundWhileTheSetGrows)
+{
+    HashSet<std::string, FnvHash> s{FnvHash{}};
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        s.add("WORD" + std::to_string(i));
+
+        std::string first{"XWORD0X"};
+        ASSERT_TRUE(s.contains(std::string_view{first}.substr(1, 5)));
+    }
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::string word = "WORD" + std::to_string(i);
+        ASSERT_TRUE(s.contains(std::string_view{word}));
+    }
+}
@@ -0,0 +1,116 @@
+// LRUCache_Tests.cpp
+//
+// Unit tests for LRUCache, and for WordChecker's suggestion cache.
+
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "AVLSet.hpp"
+#include "LRUCache.hpp"
+#include "WordChecker.hpp"
+
+
+TEST(LRUCache_Tests, evictsLeastRecentlyUsedEntry)
+{
+    LRUCache<std::string, int> cache{2};
+    int value = 0;
+
+    cache.put("A", 1);
+    cache.put("B", 2);
+    EXPECT_TRUE(cache.get("A", value));
+    EXPECT_EQ(1, value);
+
+    cache.put("C", 3);
+    EXPECT_FALSE(cache.get("B", value));
+    EXPECT_TRUE(cache.get("A", value));
+    EXPECT_TRUE(cache.get("C", value));
+    EXPECT_EQ(3, value);
+
+    LRUCacheStats stats = cache.stats();
+    EXPECT_EQ(3u, stats.hits);
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(1u, stats.evictions);
+    EXPECT_EQ(2u, stats.size);
+    EXPECT_EQ(2u, stats.capacity);
+}
+
+
+TEST(LRUCache_Tests, putReplacesExistingValue)
+{
+    LRUCache<int, int> cache{2};
+    int value = 0;
+
+    cache.put(1, 10);
+    cache.put(1, 11);
+    EXPECT_TRUE(cache.get(1, value));
+    EXPECT_EQ(11, value);
+    EXPECT_EQ(1u, cache.stats().size);
+    EXPECT_EQ(0u, cache.stats().evictions);
+}
+
+
+TEST(LRUCache_Tests, clearEmptiesTheCache)
+{
+    LRUCache<int, int> cache{2};
+    int value = 0;
+
+    cache.put(1, 10);
+    cache.clear();
+    EXPECT_FALSE(cache.get(1, value));
+    EXPECT_EQ(0u, cache.stats().size);
+}
+
+
+TEST(LRUCache_Tests, canBeSharedByThreads)
+{
+    LRUCache<int, int> cache{64};
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&cache, t]()
+        {
+            int value = 0;
+            for (int i = 0; i < 10000; ++i)
+            {
+                if (!cache.get(i % 100, value))
+                {
+                    cache.put(i % 100, t);
+                }
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    LRUCacheStats stats = cache.stats();
+    EXPECT_EQ(40000u, stats.hits + stats.misses);
+    EXPECT_LE(stats.size, 64u);
+}
+
+
+TEST(LRUCache_Tests, wordCheckerCachesSuggestionsUntilInvalidated)
+{
+    AVLSet<std::string> set;
+    set.add("THE");
+
+    WordChecker checker{set};
+    checker.enableSuggestionCache(10);
+
+    EXPECT_EQ((std::vector<std::string>{"THE"}), checker.findSuggestions("TEH"));
+    EXPECT_EQ((std::vector<std::string>{"THE"}), checker.findSuggestions("TEH"));
+
+    set.add("ETH");
+    EXPECT_EQ((std::vector<std::string>{"THE"}), checker.findSuggestions("TEH"));
+
+    checker.invalidateSuggestionCache();
+    EXPECT_EQ((std::vector<std::string>{"ETH", "THE"}), checker.findSuggestions("TEH"));
+
+    LRUCacheStats stats = checker.suggestionCacheStats();
+    EXPECT_EQ(2u, stats.hits);
+    EXPECT_EQ(2u, stats.misses);
+}
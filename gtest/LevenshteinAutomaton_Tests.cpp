@@ -0,0 +1,140 @@
+// LevenshteinAutomaton_Tests.cpp
+//
+// Unit tests for LevenshteinAutomaton, on its own and intersected with a
+// TrieSet or a sorted vector of words, and for the WordChecker queries
+// that use it.
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "AVLSet.hpp"
+#include "EditDistance.hpp"
+#include "LevenshteinAutomaton.hpp"
+#include "TrieSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    std::vector<std::string> randomWords(unsigned int count, unsigned int seed)
+    {
+        std::mt19937 rng{seed};
+        std::vector<std::string> words;
+
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            std::string word(rng() % 9, ' ');
+
+            for (char& c : word)
+            {
+                c = static_cast<char>('A' + rng() % 4);
+            }
+
+            words.push_back(word);
+        }
+
+        return words;
+    }
+}
+
+
+TEST(LevenshteinAutomaton_Tests, stepsTrackDistance)
+{
+    LevenshteinAutomaton automaton{"CAT", 1};
+
+    LevenshteinAutomaton::State state = automaton.start();
+    EXPECT_FALSE(automaton.isMatch(state));
+    EXPECT_TRUE(automaton.canMatch(state));
+
+    state = automaton.step(automaton.step(state, 'C'), 'A');
+    EXPECT_TRUE(automaton.isMatch(state));
+
+    state = automaton.step(state, 'T');
+    EXPECT_TRUE(automaton.isMatch(state));
+
+    state = automaton.step(state, 'S');
+    EXPECT_TRUE(automaton.isMatch(state));
+
+    state = automaton.step(state, 'S');
+    EXPECT_FALSE(automaton.isMatch(state));
+    EXPECT_FALSE(automaton.canMatch(state));
+}
+
+
+TEST(LevenshteinAutomaton_Tests, intersectionsMatchExhaustiveSearch)
+{
+    std::vector<std::string> dictionary = randomWords(1500, 46);
+    TrieSet trie;
+
+    for (const std::string& word : dictionary)
+    {
+        trie.add(word);
+    }
+
+    std::sort(dictionary.begin(), dictionary.end());
+    dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
+
+    for (const std::string& query : randomWords(100, 47))
+    {
+        for (unsigned int k = 0; k <= 3; ++k)
+        {
+            std::vector<std::string> expected;
+
+            for (const std::string& word : dictionary)
+            {
+                if (levenshteinDistance(query, word) <= k)
+                {
+                    expected.push_back(word);
+                }
+            }
+
+            LevenshteinAutomaton automaton{query, k};
+            ASSERT_EQ(expected, automaton.intersect(trie)) << query << " " << k;
+            ASSERT_EQ(expected, automaton.intersect(dictionary)) << query << " " << k;
+        }
+    }
+}
+
+
+TEST(LevenshteinAutomaton_Tests, trieIntersectionsAreSortedLikeStrings)
+{
+    // "\xC3\xBC" is 'ü' in UTF-8; its bytes are negative as plain chars.
+    std::vector<std::string> words{"MUT", "M\xC3\xBCT", "MAT", "MZT"};
+    TrieSet trie;
+
+    for (const std::string& word : words)
+    {
+        trie.add(word);
+    }
+
+    std::sort(words.begin(), words.end());
+
+    LevenshteinAutomaton automaton{"MXT", 2};
+    EXPECT_EQ(words, automaton.intersect(trie));
+}
+
+
+TEST(LevenshteinAutomaton_Tests, wordCheckerUsesTrieOrSortedWords)
+{
+    std::vector<std::string> expected{"RECEIVE", "RECIPE"};
+
+    TrieSet trie;
+    AVLSet<std::string> avl;
+    for (const char* word : {"RECEIVE", "RECIPE", "DECEIVE", "BANANA"})
+    {
+        trie.add(word);
+        avl.add(word);
+    }
+
+    WordChecker trieChecker{trie};
+    EXPECT_EQ(expected, trieChecker.findWordsWithinDistance("RECIEVE", 2));
+
+    std::vector<std::string> sortedWords;
+    avl.inorder([&](const std::string& word) { sortedWords.push_back(word); });
+
+    WordChecker avlChecker{avl};
+    avlChecker.useSortedWords(sortedWords);
+    EXPECT_EQ(expected, avlChecker.findWordsWithinDistance("RECIEVE", 2));
+}
@@ -0,0 +1,84 @@
+// PhoneticIndex_Tests.cpp
+//
+// Unit tests for metaphoneKey(), PhoneticIndex, and
+// WordChecker::findSoundAlikes(), which uses them.
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "AVLSet.hpp"
+#include "PhoneticIndex.hpp"
+#include "WordChecker.hpp"
+
+
+TEST(PhoneticIndex_Tests, soundAlikeSpellingsShareAKey)
+{
+    EXPECT_EQ("FNTK", metaphoneKey("PHONETIC"));
+    EXPECT_EQ("FNTK", metaphoneKey("fonetik"));
+    EXPECT_EQ(metaphoneKey("NIGHT"), metaphoneKey("NITE"));
+    EXPECT_EQ(metaphoneKey("KNIGHT"), metaphoneKey("NIGHT"));
+    EXPECT_EQ(metaphoneKey("CAT"), metaphoneKey("KATT"));
+    EXPECT_EQ(metaphoneKey("SCIENCE"), metaphoneKey("SIENSE"));
+    EXPECT_EQ(metaphoneKey("WRITE"), metaphoneKey("RIGHT"));
+}
+
+
+TEST(PhoneticIndex_Tests, appliesTheMetaphoneRules)
+{
+    EXPECT_EQ("0M", metaphoneKey("THUMB"));
+    EXPECT_EQ("XRX", metaphoneKey("CHURCH"));
+    EXPECT_EQ("SKL", metaphoneKey("SCHOOL"));
+    EXPECT_EQ("JJ", metaphoneKey("JUDGE"));
+    EXPECT_EQ("SN", metaphoneKey("SIGN"));
+    EXPECT_EQ("SKSN", metaphoneKey("SAXON"));
+    EXPECT_EQ("SFR", metaphoneKey("XAVIER"));
+    EXPECT_EQ("NXN", metaphoneKey("NATION"));
+    EXPECT_EQ("WT", metaphoneKey("WHAT"));
+    EXPECT_EQ("ELN", metaphoneKey("ELLEN"));
+}
+
+
+TEST(PhoneticIndex_Tests, ignoresCaseAndNonLetters)
+{
+    EXPECT_EQ(metaphoneKey("PHONETIC"), metaphoneKey("Phon-etic"));
+    EXPECT_EQ("TNT", metaphoneKey("don't"));
+    EXPECT_EQ("", metaphoneKey(""));
+    EXPECT_EQ("", metaphoneKey("'"));
+}
+
+
+TEST(PhoneticIndex_Tests, findsWordsWithTheSameKey)
+{
+    PhoneticIndex index;
+    for (const char* word : {"PHONETIC", "FANATIC", "PHONETIC", "NIGHT", "KNIGHT", "CAT", "'"})
+    {
+        index.add(word);
+    }
+
+    EXPECT_EQ(5u, index.size());
+    EXPECT_EQ(3u, index.bucketCount());
+    EXPECT_EQ(2u, index.largestBucket());
+
+    EXPECT_EQ((std::vector<std::string>{"FANATIC", "PHONETIC"}), index.findSoundAlikes("FONETIK"));
+    EXPECT_EQ((std::vector<std::string>{"KNIGHT", "NIGHT"}), index.findSoundAlikes("NITE"));
+    EXPECT_TRUE(index.findSoundAlikes("DOG").empty());
+}
+
+
+TEST(PhoneticIndex_Tests, wordCheckerFindsSoundAlikesBeyondOneEdit)
+{
+    AVLSet<std::string> set;
+    PhoneticIndex index;
+    for (const char* word : {"PHONETIC", "FANATIC", "CAT"})
+    {
+        set.add(word);
+        index.add(word);
+    }
+
+    WordChecker checker{set};
+    EXPECT_TRUE(checker.findSoundAlikes("FONETIK").empty());
+    EXPECT_TRUE(checker.findSuggestions("FONETIK").empty());
+
+    checker.usePhoneticIndex(index);
+    EXPECT_EQ((std::vector<std::string>{"FANATIC", "PHONETIC"}), checker.findSoundAlikes("FONETIK"));
+}
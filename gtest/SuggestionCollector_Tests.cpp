@@ -0,0 +1,78 @@
+// SuggestionCollector_Tests.cpp
+//
+// Unit tests covering SuggestionCollector, which gathers the distinct
+// suggestions findSuggestions() finds.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "SuggestionCollector.hpp"
+
+
+TEST(SuggestionCollector_Tests, startsEmpty)
+{
+    SuggestionCollector collector;
+
+    EXPECT_EQ(0u, collector.size());
+    EXPECT_FALSE(collector.contains("THE"));
+    EXPECT_FALSE(collector.contains(""));
+    EXPECT_TRUE(collector.suggestions(SuggestionOrder::Sorted).empty());
+}
+
+
+TEST(SuggestionCollector_Tests, dropsRepeats)
+{
+    SuggestionCollector collector;
+
+    EXPECT_TRUE(collector.add("THE"));
+    EXPECT_TRUE(collector.add("ETH"));
+    EXPECT_FALSE(collector.add("THE"));
+    EXPECT_TRUE(collector.add(""));
+    EXPECT_FALSE(collector.add(""));
+
+    EXPECT_EQ(3u, collector.size());
+    EXPECT_TRUE(collector.contains("THE"));
+    EXPECT_TRUE(collector.contains(""));
+    EXPECT_FALSE(collector.contains("TH"));
+}
+
+
+TEST(SuggestionCollector_Tests, sortsOnlyWhenAsked)
+{
+    SuggestionCollector collector;
+    for (const char* suggestion : {"THE", "ETH", "TE H", "ETH", "EH"})
+    {
+        collector.add(suggestion);
+    }
+
+    EXPECT_EQ((std::vector<std::string>{"THE", "ETH", "TE H", "EH"}),
+              collector.suggestions(SuggestionOrder::Found));
+    EXPECT_EQ((std::vector<std::string>{"EH", "ETH", "TE H", "THE"}),
+              collector.suggestions(SuggestionOrder::Sorted));
+}
+
+
+TEST(SuggestionCollector_Tests, growsPastItsFirstTable)
+{
+    SuggestionCollector collector;
+    std::vector<std::string> expected;
+
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+        std::string suggestion = "WORD" + std::to_string(i * 7 % 1000);
+        EXPECT_TRUE(collector.add(suggestion));
+        EXPECT_FALSE(collector.add(suggestion));
+        expected.push_back(suggestion);
+    }
+
+    EXPECT_EQ(1000u, collector.size());
+    for (const std::string& suggestion : expected)
+    {
+        EXPECT_TRUE(collector.contains(suggestion));
+    }
+    EXPECT_EQ(expected, collector.suggestions(SuggestionOrder::Found));
+
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(expected, collector.suggestions(SuggestionOrder::Sorted));
+}
@@ -0,0 +1,147 @@
+// SuggestionTechniques_Tests.cpp
+//
+// Unit tests covering the fifth technique's dynamic program, which splits
+// a run-together word into two words, or into the fewest words it can.
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "AVLSet.hpp"
+#include "SuggestionTechniques.hpp"
+#include "TrieSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    // splits() returns the splits forEachSplit() finds for the given word,
+    // counting how many times each substring is looked up.
+    std::vector<std::string> splits(const std::string& word, const std::set<std::string>& words,
+                                    std::map<std::string, unsigned int>& lookups)
+    {
+        std::vector<std::string> result;
+
+        forEachSplit(word, [&](const std::string& part)
+        {
+            lookups[part]++;
+            return words.count(part) != 0;
+        }, [&](const std::string& split, SuggestionTechnique technique)
+        {
+            EXPECT_EQ(SuggestionTechnique::Split, technique);
+            result.push_back(split);
+        }, UnlimitedBudget{});
+
+        return result;
+    }
+
+
+    const std::set<std::string> WORDS{"THE", "QUICK", "BROWN", "FOX", "THEQUICK", "BROW", "NFOX", "OX", "A"};
+}
+
+
+TEST(SuggestionTechniques_Tests, splitsIntoTheFewestWords)
+{
+    std::map<std::string, unsigned int> lookups;
+
+    EXPECT_EQ((std::vector<std::string>{"THE QUICK A"}), splits("THEQUICKA", {"THE", "QUICK", "A"}, lookups));
+
+    // "THEQUICK BROW NFOX" has as few words, but when there's a tie, the
+    // longest last word wins.
+    EXPECT_EQ((std::vector<std::string>{"THEQUICK BROW NFOX"}), splits("THEQUICKBROWNFOX", WORDS, lookups));
+    EXPECT_EQ((std::vector<std::string>{"THEQUICK BROWN FOX"}),
+              splits("THEQUICKBROWNFOX", {"THE", "QUICK", "THEQUICK", "BROWN", "FOX"}, lookups));
+}
+
+
+TEST(SuggestionTechniques_Tests, stillSplitsInTwo)
+{
+    std::map<std::string, unsigned int> lookups;
+
+    EXPECT_EQ((std::vector<std::string>{"THEQUICK A"}), splits("THEQUICKA", WORDS, lookups));
+    EXPECT_EQ((std::vector<std::string>{"BROW NFOX", "BROWN FOX"}), splits("BROWNFOX", WORDS, lookups));
+}
+
+
+TEST(SuggestionTechniques_Tests, wordsThatCantBeSplitGetNoSplits)
+{
+    std::map<std::string, unsigned int> lookups;
+
+    EXPECT_TRUE(splits("THEQUICKX", WORDS, lookups).empty());
+    EXPECT_TRUE(splits("THE", WORDS, lookups).empty());
+    EXPECT_TRUE(splits("", WORDS, lookups).empty());
+}
+
+
+TEST(SuggestionTechniques_Tests, looksUpEachSubstringAtMostOnce)
+{
+    // Every substring of the alphabet is different, and every position in
+    // it can be reached, since every letter is a word.
+    std::string word = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    std::set<std::string> words{"ABC", "DEFG", "HIJKLMNOPQRSTUVWXYZ"};
+    for (char c : word)
+    {
+        words.insert(std::string(1, c));
+    }
+
+    std::map<std::string, unsigned int> lookups;
+    EXPECT_EQ((std::vector<std::string>{"ABC DEFG HIJKLMNOPQRSTUVWXYZ"}), splits(word, words, lookups));
+
+    EXPECT_EQ(word.size() * (word.size() + 1) / 2 - 1, lookups.size());
+    for (const auto& lookup : lookups)
+    {
+        EXPECT_EQ(1u, lookup.second) << lookup.first;
+    }
+
+    // When nothing after the first few letters is reachable, the rest of
+    // the substrings are never looked up at all.
+    lookups.clear();
+    EXPECT_TRUE(splits(word, {"B"}, lookups).empty());
+    EXPECT_EQ(word.size() - 1, lookups.size());
+}
+
+
+TEST(SuggestionTechniques_Tests, stopsWhenTheBudgetRunsOut)
+{
+    struct TenLookups
+    {
+        unsigned int left = 10;
+        bool spend() { return left-- > 0; }
+    };
+
+    unsigned int lookups = 0;
+    unsigned int found = 0;
+    forEachSplit("THEQUICKBROWNFOX", [&](const std::string& part)
+    {
+        lookups++;
+        return WORDS.count(part) != 0;
+    }, [&](const std::string&, SuggestionTechnique)
+    {
+        found++;
+    }, TenLookups{});
+
+    EXPECT_EQ(10u, lookups);
+    EXPECT_EQ(0u, found);
+}
+
+
+TEST(SuggestionTechniques_Tests, wordCheckerSplitsRunTogetherWords)
+{
+    AVLSet<std::string> set;
+    TrieSet trie;
+    for (const std::string& word : WORDS)
+    {
+        set.add(word);
+        trie.add(word);
+    }
+
+    for (const Set<std::string>* words : std::vector<const Set<std::string>*>{&set, &trie})
+    {
+        WordChecker checker{*words};
+
+        std::vector<std::string> suggestions = checker.findSuggestions("THEQUICKBROWNFOX");
+        EXPECT_NE(suggestions.end(), std::find(suggestions.begin(), suggestions.end(), "THEQUICK BROW NFOX"));
+    }
+}
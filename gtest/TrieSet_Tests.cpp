@@ -0,0 +1,119 @@
+// TrieSet_Tests.cpp
+//
+// Unit tests for TrieSet, and for WordChecker's trie-pruned suggestions.
+
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "AVLSet.hpp"
+#include "TrieSet.hpp"
+#include "WordChecker.hpp"
+
+
+TEST(TrieSet_Tests, inheritFromSet)
+{
+    TrieSet s;
+    Set<std::string>& ss = s;
+    EXPECT_TRUE(ss.isImplemented());
+    EXPECT_EQ(0, ss.size());
+}
+
+
+TEST(TrieSet_Tests, containsOnlyElementsAdded)
+{
+    TrieSet s;
+    s.add("CAT");
+    s.add("CART");
+    s.add("CAT");
+    s.add("");
+
+    EXPECT_EQ(3, s.size());
+    EXPECT_TRUE(s.contains("CAT"));
+    EXPECT_TRUE(s.contains("CART"));
+    EXPECT_TRUE(s.contains(""));
+    EXPECT_FALSE(s.contains("CA"));
+    EXPECT_FALSE(s.contains("CATS"));
+    EXPECT_FALSE(s.contains("DOG"));
+}
+
+
+TEST(TrieSet_Tests, copiesAndMovesAreIndependent)
+{
+    TrieSet s;
+    s.add("CAT");
+
+    TrieSet copied{s};
+    copied.add("DOG");
+    EXPECT_FALSE(s.contains("DOG"));
+    EXPECT_TRUE(copied.contains("CAT"));
+
+    TrieSet moved{std::move(copied)};
+    EXPECT_TRUE(moved.contains("DOG"));
+
+    s = moved;
+    EXPECT_TRUE(s.contains("DOG"));
+    EXPECT_EQ(2, s.size());
+
+    TrieSet assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(2, assigned.size());
+}
+
+
+TEST(TrieSet_Tests, positionsWalkPrefixesAndChildrenInOrder)
+{
+    TrieSet s;
+    s.add("CAT");
+    s.add("COT");
+    s.add("CUT");
+    s.add("CA");
+
+    TrieSet::Position c = s.child(s.root(), 'C');
+    EXPECT_TRUE(c.exists());
+    EXPECT_FALSE(c.isWord());
+    EXPECT_TRUE(s.follow(c, "A").isWord());
+    EXPECT_FALSE(s.child(s.root(), 'D').exists());
+    EXPECT_FALSE(s.follow(s.root(), "CATS").exists());
+
+    std::string letters;
+    for (TrieSet::Position p = s.firstChild(c); p.exists(); p = s.nextSibling(p))
+    {
+        letters += p.letter();
+    }
+    EXPECT_EQ("AOU", letters);
+}
+
+
+TEST(TrieSet_Tests, prunedSuggestionsMatchUnprunedOnes)
+{
+    std::mt19937 rng{46};
+    auto randomWord = [&](unsigned int maxLength)
+    {
+        std::string word(1 + rng() % maxLength, ' ');
+        for (char& c : word)
+        {
+            c = "ABCDEa"[rng() % 6];
+        }
+        return word;
+    };
+
+    AVLSet<std::string> avl;
+    TrieSet trie;
+
+    for (unsigned int i = 0; i < 2000; ++i)
+    {
+        std::string word = randomWord(6);
+        avl.add(word);
+        trie.add(word);
+    }
+
+    WordChecker avlChecker{avl};
+    WordChecker trieChecker{trie};
+
+    for (unsigned int i = 0; i < 2000; ++i)
+    {
+        std::string word = randomWord(7);
+        ASSERT_EQ(avlChecker.findSuggestions(word), trieChecker.findSuggestions(word)) << word;
+    }
+}
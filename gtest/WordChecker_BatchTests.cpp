@@ -0,0 +1,135 @@
+// WordChecker_BatchTests.cpp
+//
+// Unit tests for the batch form of WordChecker::findSuggestions(), which
+// spreads a vector of misspelled words across a pool of worker threads.
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "HashSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    unsigned int stringHash(const std::string& s)
+    {
+        unsigned int hash = 0;
+
+        for (char c : s)
+        {
+            hash = hash * 31 + static_cast<unsigned char>(c);
+        }
+
+        return hash;
+    }
+
+
+    // A ThrowingSet fails every lookup of a word containing "ZZ" and counts
+    // the lookups that succeed.
+    class ThrowingSet : public Set<std::string>
+    {
+    public:
+        bool isImplemented() const noexcept override
+        {
+            return true;
+        }
+
+        void add(const std::string&) override
+        {
+        }
+
+        bool contains(const std::string& element) const override
+        {
+            if (element.find("ZZ") != std::string::npos)
+            {
+                throw std::runtime_error{"lookup failed"};
+            }
+
+            ++lookups;
+            return false;
+        }
+
+        unsigned int size() const noexcept override
+        {
+            return 0;
+        }
+
+        mutable std::atomic<unsigned int> lookups{0};
+    };
+}
+
+
+TEST(WordChecker_BatchTests, batchMatchesOneWordAtATime)
+{
+    HashSet<std::string> set{stringHash};
+    set.add("THE");
+    set.add("HELLO");
+    set.add("WORLD");
+    set.add("WORD");
+    set.add("CAT");
+    set.add("CART");
+
+    WordChecker checker{set};
+
+    std::vector<std::string> words{"TEH", "HELO", "WROLD", "CATR", "CT", "XYZZY"};
+
+    for (unsigned int threads : {1u, 2u, 4u, 16u})
+    {
+        std::vector<std::vector<std::string>> batch = checker.findSuggestions(words, threads);
+        ASSERT_EQ(words.size(), batch.size());
+
+        for (std::size_t i = 0; i < words.size(); ++i)
+        {
+            EXPECT_EQ(checker.findSuggestions(words[i]), batch[i]);
+        }
+    }
+}
+
+
+TEST(WordChecker_BatchTests, emptyBatchGivesNoResults)
+{
+    HashSet<std::string> set{stringHash};
+    WordChecker checker{set};
+
+    EXPECT_TRUE(checker.findSuggestions(std::vector<std::string>{}).empty());
+}
+
+
+TEST(WordChecker_BatchTests, exceptionInAWorkerIsRethrownToTheCaller)
+{
+    ThrowingSet set;
+    WordChecker checker{set};
+
+    checker.findSuggestions("ABC");
+    const unsigned int lookupsPerWord = set.lookups;
+    ASSERT_GT(lookupsPerWord, 0u);
+
+    // Every candidate derived from "ZZZZ" contains "ZZ", so only words[37]
+    // fails; no candidate derived from "ABC" does.
+    std::vector<std::string> words(64, "ABC");
+    words[37] = "ZZZZ";
+
+    for (unsigned int threads : {1u, 4u})
+    {
+        set.lookups = 0;
+
+        try
+        {
+            checker.findSuggestions(words, threads);
+            ADD_FAILURE() << "no exception with " << threads << " threads";
+        }
+        catch (const std::runtime_error& e)
+        {
+            EXPECT_STREQ("lookup failed", e.what());
+        }
+
+        // Words 0 through 36 were all claimed before words[37], and a worker
+        // finishes the word it's on before it stops, so every one of them
+        // was checked in full and no word was abandoned part way through.
+        EXPECT_GE(set.lookups, 37 * lookupsPerWord) << threads << " threads";
+        EXPECT_EQ(0u, set.lookups % lookupsPerWord) << threads << " threads";
+    }
+}
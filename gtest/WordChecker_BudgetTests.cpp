@@ -0,0 +1,141 @@
+// WordChecker_BudgetTests.cpp
+//
+// Unit tests covering the budgeted form of WordChecker::findSuggestions(),
+// which stops when its lookups or its time run out.
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "AVLSet.hpp"
+#include "TrieSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    // CountingSet counts the lookups made through it.
+    class CountingSet : public Set<std::string>
+    {
+    public:
+        explicit CountingSet(const Set<std::string>& words)
+            : words{words}, lookups{0}
+        {
+        }
+
+        bool isImplemented() const noexcept override { return true; }
+        void add(const std::string&) override { }
+        bool contains(const std::string& element) const override { lookups++; return words.contains(element); }
+        unsigned int size() const noexcept override { return words.size(); }
+
+        const Set<std::string>& words;
+        mutable unsigned long long lookups;
+    };
+
+
+    const std::vector<std::string> WORDS{"ETH", "THE", "TEA", "TECH", "TH", "EH", "T", "EH"};
+
+
+    SuggestionBudget lookupBudget(unsigned long long maxLookups)
+    {
+        SuggestionBudget budget;
+        budget.maxLookups = maxLookups;
+        return budget;
+    }
+}
+
+
+TEST(WordChecker_BudgetTests, unlimitedBudgetFindsEverything)
+{
+    AVLSet<std::string> set;
+    for (const std::string& word : WORDS)
+    {
+        set.add(word);
+    }
+    WordChecker checker{set};
+
+    PartialSuggestions result = checker.findSuggestions("TEH", SuggestionBudget{});
+
+    EXPECT_FALSE(result.partial);
+    EXPECT_EQ(checker.findSuggestions("TEH"), result.suggestions);
+}
+
+
+TEST(WordChecker_BudgetTests, stopsWhenLookupsRunOut)
+{
+    AVLSet<std::string> set;
+    for (const std::string& word : WORDS)
+    {
+        set.add(word);
+    }
+    CountingSet counting{set};
+    WordChecker checker{counting};
+
+    checker.findSuggestions("TEH");
+    unsigned long long everyLookup = counting.lookups;
+
+    counting.lookups = 0;
+    PartialSuggestions exact = checker.findSuggestions("TEH", lookupBudget(everyLookup));
+    EXPECT_FALSE(exact.partial);
+    EXPECT_EQ(everyLookup, counting.lookups);
+
+    // The swaps come first, so two lookups are enough to find both of them.
+    counting.lookups = 0;
+    PartialSuggestions swaps = checker.findSuggestions("TEH", lookupBudget(2));
+    EXPECT_TRUE(swaps.partial);
+    EXPECT_EQ(2u, counting.lookups);
+    EXPECT_EQ((std::vector<std::string>{"ETH", "THE"}), swaps.suggestions);
+
+    counting.lookups = 0;
+    PartialSuggestions most = checker.findSuggestions("TEH", lookupBudget(everyLookup - 1));
+    EXPECT_TRUE(most.partial);
+    EXPECT_LE(counting.lookups, everyLookup - 1);
+}
+
+
+TEST(WordChecker_BudgetTests, stopsAtTheDeadline)
+{
+    AVLSet<std::string> set;
+    for (const std::string& word : WORDS)
+    {
+        set.add(word);
+    }
+    TrieSet trie;
+    for (const std::string& word : WORDS)
+    {
+        trie.add(word);
+    }
+
+    SuggestionBudget budget;
+    budget.deadline = std::chrono::steady_clock::now() - std::chrono::milliseconds{1};
+
+    for (const Set<std::string>* words : std::vector<const Set<std::string>*>{&set, &trie})
+    {
+        WordChecker checker{*words};
+        PartialSuggestions result = checker.findSuggestions("TEH", budget);
+
+        EXPECT_TRUE(result.partial);
+        EXPECT_TRUE(result.suggestions.empty());
+    }
+}
+
+
+TEST(WordChecker_BudgetTests, onlyCompleteResultsAreCached)
+{
+    AVLSet<std::string> set;
+    for (const std::string& word : WORDS)
+    {
+        set.add(word);
+    }
+    WordChecker checker{set};
+    checker.enableSuggestionCache(10);
+
+    EXPECT_TRUE(checker.findSuggestions("TEH", lookupBudget(2)).partial);
+    EXPECT_EQ(0u, checker.suggestionCacheStats().size);
+
+    std::vector<std::string> everything = checker.findSuggestions("TEH");
+
+    PartialSuggestions cached = checker.findSuggestions("TEH", lookupBudget(1));
+    EXPECT_FALSE(cached.partial);
+    EXPECT_EQ(everything, cached.suggestions);
+}
@@ -0,0 +1,199 @@
+// WordChecker_LazyTests.cpp
+//
+// Unit tests covering WordChecker::lazySuggestions(), whose SuggestionRange
+// finds suggestions one at a time, only as they're asked for.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "AVLSet.hpp"
+#include "TrieSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    // CountingSet counts the lookups made through it.
+    class CountingSet : public Set<std::string>
+    {
+    public:
+        explicit CountingSet(const Set<std::string>& words)
+            : words{words}, lookups{0}
+        {
+        }
+
+        bool isImplemented() const noexcept override { return true; }
+        void add(const std::string&) override { }
+        bool contains(const std::string& element) const override { lookups++; return words.contains(element); }
+        unsigned int size() const noexcept override { return words.size(); }
+
+        const Set<std::string>& words;
+        mutable unsigned long long lookups;
+    };
+
+
+    const std::vector<std::string> WORDS{"ETH", "THE", "TEA", "TECH", "TH", "EH", "T", "E", "TE", "HE"};
+
+
+    std::vector<std::string> collectSorted(SuggestionRange range)
+    {
+        std::vector<std::string> suggestions;
+
+        for (const std::string& suggestion : range)
+        {
+            suggestions.push_back(suggestion);
+        }
+
+        std::sort(suggestions.begin(), suggestions.end());
+        return suggestions;
+    }
+}
+
+
+TEST(WordChecker_LazyTests, findsTheSameSuggestionsAsFindSuggestions)
+{
+    AVLSet<std::string> set;
+    TrieSet trie;
+    for (const std::string& word : WORDS)
+    {
+        set.add(word);
+        trie.add(word);
+    }
+
+    for (const Set<std::string>* words : std::vector<const Set<std::string>*>{&set, &trie})
+    {
+        WordChecker checker{*words};
+
+        for (const char* word : {"TEH", "TECHE", "TEHE", "", "THEE", "EHT"})
+        {
+            EXPECT_EQ(checker.findSuggestions(word), collectSorted(checker.lazySuggestions(word)))
+                << "for \"" << word << "\"";
+        }
+    }
+}
+
+
+TEST(WordChecker_LazyTests, editsWholeCharacters)
+{
+    AVLSet<std::string> set;
+    for (const char* word : {"gr\xC3\xBC\xC3\x9F", "gru\xC3\x9F", "gr\xC3\xBC", "\xC3\x9F"})
+    {
+        set.add(word);
+    }
+    WordChecker checker{set};
+    checker.useAlphabet(SuggestionAlphabet::German);
+
+    for (const char* word : {"gr\xC3\xBC\xC3\xB6", "gr\xC3\x9F\xC3\xBC", "gr\xC3\xBC\xC3\x9F"})
+    {
+        EXPECT_EQ(checker.findSuggestions(word), collectSorted(checker.lazySuggestions(word)));
+    }
+}
+
+
+TEST(WordChecker_LazyTests, suggestionsComeInTechniqueOrderOnlyOnce)
+{
+    AVLSet<std::string> set;
+    for (const std::string& word : WORDS)
+    {
+        set.add(word);
+    }
+    WordChecker checker{set};
+
+    SuggestionRange range = checker.lazySuggestions("TEH");
+    std::vector<std::string> suggestions;
+    std::vector<SuggestionTechnique> techniques;
+    while (range.next())
+    {
+        suggestions.push_back(range.current());
+        techniques.push_back(range.technique());
+    }
+
+    EXPECT_TRUE(std::is_sorted(techniques.begin(), techniques.end()));
+    EXPECT_EQ(SuggestionTechnique::Swap, techniques.front());
+    EXPECT_EQ(SuggestionTechnique::Split, techniques.back());
+
+    std::vector<std::string> sorted = suggestions;
+    std::sort(sorted.begin(), sorted.end());
+    EXPECT_EQ(sorted.end(), std::adjacent_find(sorted.begin(), sorted.end()));
+
+    EXPECT_FALSE(range.next());
+}
+
+
+TEST(WordChecker_LazyTests, stopsLookingOnceTheCallerStops)
+{
+    AVLSet<std::string> set;
+    for (const std::string& word : WORDS)
+    {
+        set.add(word);
+    }
+    CountingSet counting{set};
+    WordChecker checker{counting};
+
+    checker.findSuggestions("TEH");
+    unsigned long long everyLookup = counting.lookups;
+
+    // "ETH" is the very first swap, so it takes a single lookup.
+    counting.lookups = 0;
+    SuggestionRange range = checker.lazySuggestions("TEH");
+    ASSERT_TRUE(range.next());
+    EXPECT_EQ("ETH", range.current());
+    EXPECT_EQ(SuggestionTechnique::Swap, range.technique());
+    EXPECT_EQ(1u, counting.lookups);
+
+    // The rest are found where next() left off.
+    std::vector<std::string> rest;
+    for (const std::string& suggestion : range)
+    {
+        rest.push_back(suggestion);
+    }
+    EXPECT_EQ("THE", rest.front());
+    EXPECT_EQ(everyLookup, counting.lookups);
+}
+
+
+TEST(WordChecker_LazyTests, onlyTheSplitsAreFoundAllAtOnce)
+{
+    AVLSet<std::string> set;
+    for (const std::string& word : WORDS)
+    {
+        set.add(word);
+    }
+    CountingSet counting{set};
+    WordChecker checker{counting};
+
+    // The first suggestion for "TEX" is the deletion "TE", so next() looks
+    // up the 2 swaps, the 4 * 26 insertions and 3 deletions and stops
+    // there, without touching the replacements or the splits.
+    SuggestionRange range = checker.lazySuggestions("TEX");
+    ASSERT_TRUE(range.next());
+    EXPECT_EQ("TE", range.current());
+    EXPECT_EQ(SuggestionTechnique::Delete, range.technique());
+    EXPECT_EQ(2u + 4u * 26u + 3u, counting.lookups);
+
+    // "TEA" replaces the last letter with 'A', so it's found after the
+    // 2 * 26 replacements of the first two letters and one more.
+    counting.lookups = 0;
+    ASSERT_TRUE(range.next());
+    EXPECT_EQ("TEA", range.current());
+    EXPECT_EQ(SuggestionTechnique::Replace, range.technique());
+    EXPECT_EQ(2u * 26u + 1u, counting.lookups);
+
+    // The splits, though, are all found before the first of them comes
+    // out, so the rest take no lookups at all.
+    range = checker.lazySuggestions("EHE");
+    while (range.next() && range.technique() != SuggestionTechnique::Split)
+    {
+    }
+    ASSERT_EQ(SuggestionTechnique::Split, range.technique());
+
+    counting.lookups = 0;
+    unsigned int splits = 0;
+    while (range.next())
+    {
+        ++splits;
+    }
+    EXPECT_GT(splits, 0u);
+    EXPECT_EQ(0u, counting.lookups);
+}
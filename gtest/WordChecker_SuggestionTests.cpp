@@ -0,0 +1,120 @@
+// WordChecker_SuggestionTests.cpp
+//
+// Unit tests covering each of the five techniques that
+// WordChecker::findSuggestions() uses to generate suggestions.
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "AVLSet.hpp"
+#include "WordChecker.hpp"
+#include "WordFrequencies.hpp"
+
+
+namespace
+{
+    AVLSet<std::string> makeSet(const std::vector<std::string>& words)
+    {
+        AVLSet<std::string> set;
+
+        for (const std::string& word : words)
+        {
+            set.add(word);
+        }
+
+        return set;
+    }
+}
+
+
+TEST(WordChecker_SuggestionTests, swapsAdjacentCharacters)
+{
+    AVLSet<std::string> set = makeSet({"THE", "ETH"});
+    WordChecker checker{set};
+
+    EXPECT_EQ((std::vector<std::string>{"ETH", "THE"}), checker.findSuggestions("TEH"));
+}
+
+
+TEST(WordChecker_SuggestionTests, insertsCharacters)
+{
+    AVLSet<std::string> set = makeSet({"ACAT", "CART", "CATS"});
+    WordChecker checker{set};
+
+    EXPECT_EQ((std::vector<std::string>{"ACAT", "CART", "CATS"}), checker.findSuggestions("CAT"));
+}
+
+
+TEST(WordChecker_SuggestionTests, deletesCharacters)
+{
+    AVLSet<std::string> set = makeSet({"CAT", "CAR"});
+    WordChecker checker{set};
+
+    EXPECT_EQ((std::vector<std::string>{"CAR", "CAT"}), checker.findSuggestions("CART"));
+}
+
+
+TEST(WordChecker_SuggestionTests, replacesCharacters)
+{
+    AVLSet<std::string> set = makeSet({"BAT", "COT", "CAB"});
+    WordChecker checker{set};
+
+    EXPECT_EQ((std::vector<std::string>{"BAT", "CAB", "COT"}), checker.findSuggestions("CAT"));
+}
+
+
+TEST(WordChecker_SuggestionTests, splitsIntoTwoWords)
+{
+    AVLSet<std::string> set = makeSet({"HELLO", "THERE"});
+    WordChecker checker{set};
+
+    EXPECT_EQ((std::vector<std::string>{"HELLO THERE"}), checker.findSuggestions("HELLOTHERE"));
+}
+
+
+TEST(WordChecker_SuggestionTests, splitsAreRankedByTheirRarestWord)
+{
+    AVLSet<std::string> set = makeSet({"QUICK", "BROWN", "FOX", "QUICKBROWNFOXY", "QUICKBROWNFOXS"});
+    WordFrequencies frequencies;
+    frequencies.set("QUICK", 100);
+    frequencies.set("BROWN", 100);
+    frequencies.set("FOX", 2);
+    frequencies.set("QUICKBROWNFOXY", 5);
+    frequencies.set("QUICKBROWNFOXS", 1);
+
+    WordChecker checker{set};
+    checker.useWordFrequencies(frequencies);
+
+    EXPECT_EQ((std::vector<std::string>{"QUICKBROWNFOXY", "QUICK BROWN FOX"}),
+              checker.findSuggestions("QUICKBROWNFOX", 2));
+    EXPECT_EQ((std::vector<std::string>{"QUICKBROWNFOXY", "QUICK BROWN FOX", "QUICKBROWNFOXS"}),
+              checker.findSuggestions("QUICKBROWNFOX", 3));
+}
+
+
+TEST(WordChecker_SuggestionTests, onlyInsertsAndReplacesUppercaseLetters)
+{
+    AVLSet<std::string> set = makeSet({"CAT1", "C1T"});
+    WordChecker checker{set};
+
+    EXPECT_TRUE(checker.findSuggestions("CAT").empty());
+}
+
+
+TEST(WordChecker_SuggestionTests, emptyWordOnlyGetsInsertions)
+{
+    AVLSet<std::string> set = makeSet({"A", "I"});
+    WordChecker checker{set};
+
+    EXPECT_EQ((std::vector<std::string>{"A", "I"}), checker.findSuggestions(""));
+}
+
+
+TEST(WordChecker_SuggestionTests, unsortedSuggestionsComeInTechniqueOrder)
+{
+    AVLSet<std::string> set = makeSet({"THE", "ETH", "TEA", "EH", "TE", "H"});
+    WordChecker checker{set};
+
+    EXPECT_EQ((std::vector<std::string>{"ETH", "THE", "EH", "TE", "TEA", "TE H"}),
+              checker.findSuggestions("TEH", SuggestionOrder::Found));
+}
@@ -0,0 +1,168 @@
+// WordChecker_TwoEditTests.cpp
+//
+// Unit tests covering the TwoEdits form of WordChecker::findSuggestions(),
+// which must find what applying the techniques twice would, while pruning
+// the second round with a DeletionIndex or a TrieSet.
+
+#include <set>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "AVLSet.hpp"
+#include "DeletionIndex.hpp"
+#include "TrieSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    const std::vector<std::string> WORDS{
+        "BELIEVE", "RECEIVE", "THE", "THEY", "CAT", "CART", "SCAT", "ACT",
+        "AT", "A", "TAX", "TEXT", "NEXT", "HELLO", "HELP", "YELLOW", "ALL",
+        "BALL", "CALL", "WORLD", "WORD", "SWORD"};
+
+
+    // bruteForce() applies every technique to every string one edit away
+    // from the word, with nothing pruned.
+    std::vector<std::string> bruteForce(const WordChecker& checker, const std::string& word)
+    {
+        std::vector<std::string> first = checker.findSuggestions(word);
+        std::set<std::string> result(first.begin(), first.end());
+        bool suggestedItself = result.count(word) != 0;
+
+        std::set<std::string> intermediates;
+        for (std::size_t i = 0; i + 1 < word.size(); ++i)
+        {
+            std::string s = word;
+            std::swap(s[i], s[i + 1]);
+            intermediates.insert(s);
+        }
+        for (std::size_t i = 0; i <= word.size(); ++i)
+        {
+            for (char c = 'A'; c <= 'Z'; ++c)
+            {
+                intermediates.insert(word.substr(0, i) + c + word.substr(i));
+                if (i < word.size())
+                {
+                    intermediates.insert(word.substr(0, i) + c + word.substr(i + 1));
+                }
+            }
+            if (i < word.size())
+            {
+                intermediates.insert(word.substr(0, i) + word.substr(i + 1));
+            }
+        }
+
+        for (const std::string& intermediate : intermediates)
+        {
+            for (const std::string& suggestion : checker.findSuggestions(intermediate))
+            {
+                result.insert(suggestion);
+            }
+        }
+
+        if (!suggestedItself)
+        {
+            result.erase(word);
+        }
+
+        return std::vector<std::string>(result.begin(), result.end());
+    }
+}
+
+
+TEST(WordChecker_TwoEditTests, findsWordsTwoEditsAway)
+{
+    AVLSet<std::string> set;
+    DeletionIndex index;
+    for (const std::string& word : WORDS)
+    {
+        set.add(word);
+        index.add(word);
+    }
+
+    WordChecker checker{set};
+    checker.useDeletionIndex(index);
+
+    std::vector<std::string> suggestions = checker.findSuggestions("BELEIV", SuggestionDepth::TwoEdits);
+    EXPECT_EQ((std::vector<std::string>{"BELIEVE"}), suggestions);
+    EXPECT_TRUE(checker.findSuggestions("BELEIV").empty());
+}
+
+
+TEST(WordChecker_TwoEditTests, matchesBruteForceWithEitherPruning)
+{
+    AVLSet<std::string> set;
+    TrieSet trie;
+    DeletionIndex index;
+    for (const std::string& word : WORDS)
+    {
+        set.add(word);
+        trie.add(word);
+        index.add(word);
+    }
+
+    WordChecker plain{set};
+    WordChecker indexed{set};
+    indexed.useDeletionIndex(index);
+    WordChecker walked{trie};
+
+    for (const char* query : {"TEH", "CTA", "HELOW", "WROLD", "ATX", "AL", "RECIEVE", "T", "CAT", "XQZ"})
+    {
+        std::vector<std::string> expected = bruteForce(plain, query);
+        EXPECT_EQ(expected, indexed.findSuggestions(query, SuggestionDepth::TwoEdits)) << query;
+        EXPECT_EQ(expected, walked.findSuggestions(query, SuggestionDepth::TwoEdits)) << query;
+    }
+}
+
+
+TEST(WordChecker_TwoEditTests, triesSplitsOfEveryIntermediate)
+{
+    AVLSet<std::string> set;
+    DeletionIndex index;
+    for (const char* word : {"THE", "CAT"})
+    {
+        set.add(word);
+        index.add(word);
+    }
+
+    WordChecker checker{set};
+    checker.useDeletionIndex(index);
+
+    EXPECT_EQ((std::vector<std::string>{"THE CAT"}), checker.findSuggestions("THECTA", SuggestionDepth::TwoEdits));
+}
+
+
+TEST(WordChecker_TwoEditTests, needsPruningForTheSecondRound)
+{
+    AVLSet<std::string> set;
+    for (const std::string& word : WORDS)
+    {
+        set.add(word);
+    }
+
+    WordChecker checker{set};
+
+    EXPECT_EQ(checker.findSuggestions("WROLD"), checker.findSuggestions("WROLD", SuggestionDepth::TwoEdits));
+}
+
+
+TEST(WordChecker_TwoEditTests, editsMultiByteCharactersTwice)
+{
+    // über
+    TrieSet trie;
+    trie.add("\xC3\xBC" "ber");
+    AVLSet<std::string> set;
+    set.add("\xC3\xBC" "ber");
+    DeletionIndex index;
+    index.add("\xC3\xBC" "ber");
+
+    WordChecker walked{trie};
+    walked.useAlphabet(SuggestionAlphabet::German);
+    WordChecker indexed{set};
+    indexed.useAlphabet(SuggestionAlphabet::German);
+    indexed.useDeletionIndex(index);
+
+    EXPECT_EQ((std::vector<std::string>{"\xC3\xBC" "ber"}), walked.findSuggestions("ubr", SuggestionDepth::TwoEdits));
+    EXPECT_EQ((std::vector<std::string>{"\xC3\xBC" "ber"}), indexed.findSuggestions("ubr", SuggestionDepth::TwoEdits));
+}
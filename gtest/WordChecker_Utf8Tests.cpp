@@ -0,0 +1,168 @@
+// WordChecker_Utf8Tests.cpp
+//
+// Unit tests covering WordChecker::findSuggestions() on UTF-8 words, whose
+// techniques must edit whole characters rather than single bytes.
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "Alphabet.hpp"
+#include "AVLSet.hpp"
+#include "TrieSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    AVLSet<std::string> makeSet(const std::vector<std::string>& words)
+    {
+        AVLSet<std::string> set;
+
+        for (const std::string& word : words)
+        {
+            set.add(word);
+        }
+
+        return set;
+    }
+
+
+    // RecordingSet remembers every string looked up in it.
+    class RecordingSet : public Set<std::string>
+    {
+    public:
+        bool isImplemented() const noexcept override { return true; }
+        void add(const std::string&) override { }
+        bool contains(const std::string& element) const override { lookups.push_back(element); return false; }
+        unsigned int size() const noexcept override { return 0; }
+
+        mutable std::vector<std::string> lookups;
+    };
+
+
+    bool isValidUtf8(const std::string& s)
+    {
+        for (std::size_t i = 0; i < s.size(); )
+        {
+            unsigned char lead = static_cast<unsigned char>(s[i]);
+            std::size_t length = lead < 0x80 ? 1 : lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 0;
+
+            if (length == 0 || i + length > s.size())
+            {
+                return false;
+            }
+
+            for (std::size_t j = i + 1; j < i + length; ++j)
+            {
+                if (!isUtf8ContinuationByte(s[j]))
+                {
+                    return false;
+                }
+            }
+
+            i += length;
+        }
+
+        return true;
+    }
+}
+
+
+TEST(WordChecker_Utf8Tests, alphabetsSplitIntoCodePoints)
+{
+    static_assert(alphabetIsAscii<LowercaseApostropheAlphabet>());
+    static_assert(!alphabetIsAscii<GermanAlphabet>());
+
+    EXPECT_EQ(30u, alphabetCodePoints<GermanAlphabet>().size());
+    EXPECT_EQ("\xC3\x9F", alphabetCodePoints<GermanAlphabet>().back());
+    EXPECT_EQ("\xC5\x93", alphabetCodePoints<FrenchAlphabet>()[37]);
+}
+
+
+TEST(WordChecker_Utf8Tests, onlyLooksUpValidUtf8)
+{
+    RecordingSet set;
+    WordChecker checker{set};
+    checker.useAlphabet(SuggestionAlphabet::French);
+
+    checker.findSuggestions("\xC5\x93uvr\xC3\xA9");
+
+    ASSERT_FALSE(set.lookups.empty());
+    for (const std::string& lookup : set.lookups)
+    {
+        EXPECT_TRUE(isValidUtf8(lookup)) << lookup;
+    }
+}
+
+
+TEST(WordChecker_Utf8Tests, swapsAndDeletesWholeCharacters)
+{
+    // über, bar
+    AVLSet<std::string> set = makeSet({"\xC3\xBC" "ber", "bar"});
+    WordChecker checker{set};
+    checker.useAlphabet(SuggestionAlphabet::German);
+
+    EXPECT_EQ((std::vector<std::string>{"\xC3\xBC" "ber"}), checker.findSuggestions("b\xC3\xBC" "er"));
+    EXPECT_EQ((std::vector<std::string>{"bar"}), checker.findSuggestions("b\xC3\xA4" "ar"));
+}
+
+
+TEST(WordChecker_Utf8Tests, insertsAndReplacesMultiByteLetters)
+{
+    // café, bär
+    AVLSet<std::string> set = makeSet({"caf\xC3\xA9", "b\xC3\xA4r"});
+    WordChecker french{set};
+    french.useAlphabet(SuggestionAlphabet::French);
+    WordChecker german{set};
+    german.useAlphabet(SuggestionAlphabet::German);
+
+    EXPECT_EQ((std::vector<std::string>{"caf\xC3\xA9"}), french.findSuggestions("caf"));
+    EXPECT_EQ((std::vector<std::string>{"caf\xC3\xA9"}), french.findSuggestions("caf\xC3\xA8"));
+    EXPECT_EQ((std::vector<std::string>{"b\xC3\xA4r"}), german.findSuggestions("bar"));
+}
+
+
+TEST(WordChecker_Utf8Tests, replacesMultiByteCharactersWithAsciiLetters)
+{
+    AVLSet<std::string> set = makeSet({"bar"});
+    WordChecker checker{set};
+    checker.useAlphabet(SuggestionAlphabet::Lowercase);
+
+    EXPECT_EQ((std::vector<std::string>{"bar"}), checker.findSuggestions("b\xC3\xA4r"));
+}
+
+
+TEST(WordChecker_Utf8Tests, splitsBetweenCharacters)
+{
+    // über, all
+    AVLSet<std::string> set = makeSet({"\xC3\xBC" "ber", "all"});
+    WordChecker checker{set};
+    checker.useAlphabet(SuggestionAlphabet::German);
+
+    EXPECT_EQ((std::vector<std::string>{"\xC3\xBC" "ber all"}), checker.findSuggestions("\xC3\xBC" "berall"));
+}
+
+
+TEST(WordChecker_Utf8Tests, asciiWordsGetTheSameSuggestionsEitherWay)
+{
+    std::vector<std::string> words{"cat", "cart", "act", "at", "scat", "cot", "ca", "t"};
+    AVLSet<std::string> set = makeSet(words);
+    TrieSet trie;
+    for (const std::string& word : words)
+    {
+        trie.add(word);
+    }
+
+    WordChecker bytes{set};
+    bytes.useAlphabet(SuggestionAlphabet::Lowercase);
+    WordChecker bytesInTrie{trie};
+    bytesInTrie.useAlphabet(SuggestionAlphabet::Lowercase);
+    WordChecker codePoints{set};
+    codePoints.useAlphabet(SuggestionAlphabet::German);
+
+    for (const char* query : {"cta", "cat", "ct", "caat", "cit"})
+    {
+        EXPECT_EQ(bytes.findSuggestions(query), codePoints.findSuggestions(query)) << query;
+        EXPECT_EQ(bytes.findSuggestions(query), bytesInTrie.findSuggestions(query)) << query;
+    }
+}
@@ -0,0 +1,95 @@
+// WordFrequencies_Tests.cpp
+//
+// Unit tests for WordFrequencies, and for the ranked (top-k) form of
+// WordChecker::findSuggestions() that uses them.
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "AVLSet.hpp"
+#include "TrieSet.hpp"
+#include "WordChecker.hpp"
+#include "WordFrequencies.hpp"
+
+
+TEST(WordFrequencies_Tests, unknownWordsHaveFrequencyZero)
+{
+    WordFrequencies frequencies;
+    frequencies.set("THE", 100);
+    frequencies.set("THE", 200);
+
+    EXPECT_EQ(200u, frequencies.frequency("THE"));
+    EXPECT_EQ(0u, frequencies.frequency("TEH"));
+    EXPECT_EQ(1u, frequencies.size());
+}
+
+
+TEST(WordFrequencies_Tests, loadsWordsAndFrequencies)
+{
+    std::istringstream in{"THE 500\nCAT 20\nnot a line\n\nDOG 7\n"};
+    WordFrequencies frequencies;
+
+    EXPECT_EQ(3u, frequencies.load(in));
+    EXPECT_EQ(500u, frequencies.frequency("THE"));
+    EXPECT_EQ(7u, frequencies.frequency("DOG"));
+}
+
+
+TEST(WordFrequencies_Tests, topSuggestionsAreRankedByFrequency)
+{
+    AVLSet<std::string> set;
+    WordFrequencies frequencies;
+
+    for (const auto& [word, frequency] : std::vector<std::pair<std::string, unsigned long long>>{
+             {"CART", 5}, {"CAT", 50}, {"CARE", 500}, {"CAR", 50}, {"CARTS", 1}})
+    {
+        set.add(word);
+        frequencies.set(word, frequency);
+    }
+
+    WordChecker checker{set};
+    checker.useWordFrequencies(frequencies);
+
+    // CART is the word itself (by replacing a letter with itself), CAT and
+    // CAR are deletions, CARE is a replacement and CARTS an insertion.
+    EXPECT_EQ((std::vector<std::string>{"CARE"}), checker.findSuggestions("CART", 1));
+    EXPECT_EQ((std::vector<std::string>{"CARE", "CAR", "CAT"}), checker.findSuggestions("CART", 3));
+    EXPECT_EQ((std::vector<std::string>{"CARE", "CAR", "CAT", "CART", "CARTS"}), checker.findSuggestions("CART", 10));
+    EXPECT_TRUE(checker.findSuggestions("CART", 0).empty());
+}
+
+
+TEST(WordFrequencies_Tests, techniqueBreaksTiesWithoutFrequencies)
+{
+    TrieSet set;
+    set.add("ETH");
+    set.add("TH");
+    set.add("TEHS");
+    set.add("TEA");
+
+    WordChecker checker{set};
+
+    // Swap, then insertion, then deletion, then replacement.
+    EXPECT_EQ((std::vector<std::string>{"ETH", "TEHS", "TH", "TEA"}), checker.findSuggestions("TEH", 4));
+}
+
+
+TEST(WordFrequencies_Tests, topSuggestionsAreTheSameSetAsAllSuggestions)
+{
+    AVLSet<std::string> set;
+    for (const char* word : {"A", "AA", "AAA", "AB", "BA", "ABA", "BAA", "AAB", "AB BA"})
+    {
+        set.add(word);
+    }
+
+    WordChecker checker{set};
+
+    for (const char* word : {"AA", "AAB", "ABA", "B", "ABAB"})
+    {
+        std::vector<std::string> top = checker.findSuggestions(word, 100);
+        std::sort(top.begin(), top.end());
+        EXPECT_EQ(checker.findSuggestions(word), top) << word;
+    }
+}